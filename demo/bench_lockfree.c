@@ -0,0 +1,99 @@
+// Compares the lock-free sorted set with a sorted LinkedList behind a mutex, on 1, 2, 4, 8 and 16 threads.
+// Each thread runs a mix of 10% insertions, 10% removals and 80% lookups on keys in [0, keys), the set starts half full.
+// Build the libraries with `make export` at the root, then in this directory:
+//     make compile files=bench_lockfree.c executable_file=bench_lockfree CFLAGS="-O2 -pthread" && ./bin/bench_lockfree [operations per thread] [keys]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <linkedList.h>
+
+int int_comparator(const void *a, const void *b) { int x = *(const int *)a, y = *(const int *)b; return (x > y) - (x < y); }
+int int_ordering_comparator(int a, int b) { return (a > b) - (a < b); }
+bool int_equals(int a, int b) { return a == b; }
+
+static size_t operations = 200000;
+static int keys = 1024;
+static LinkedListLockFree *set;
+static int *list;
+static pthread_mutex_t list_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+// every thread draws its own pseudo random sequence, the same for both sets
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+static void *lockfree_worker(void *arg) {
+    uint32_t state = (uint32_t)(uintptr_t)arg * 7919u + 1u;
+    for (size_t i = 0; i < operations; i++) {
+        uint32_t random = next_random(&state);
+        int key = (int)(random % (uint32_t)keys);
+        switch ((random >> 12) % 10) {
+            case 0: LinkedList_lockfree_insert_sorted(set, &key); break;
+            case 1: LinkedList_lockfree_remove_value(set, &key, NULL); break;
+            default: LinkedList_lockfree_contains(set, &key); break;
+        }
+    }
+    return NULL;
+}
+
+static void *mutex_worker(void *arg) {
+    uint32_t state = (uint32_t)(uintptr_t)arg * 7919u + 1u;
+    for (size_t i = 0; i < operations; i++) {
+        uint32_t random = next_random(&state);
+        int key = (int)(random % (uint32_t)keys);
+        uint32_t operation = (random >> 12) % 10;
+        pthread_mutex_lock(&list_mutex);
+        size_t index = LinkedList_find(&list, 0, key, int_equals);
+        if ((operation == 0) && (index == LINKEDLIST_NOT_FOUND)) {
+            LinkedList_insert_sorted(&list, key, int_ordering_comparator);
+        } else if ((operation == 1) && (index != LINKEDLIST_NOT_FOUND)) {
+            LinkedList_remove_at(&list, index);
+        }
+        pthread_mutex_unlock(&list_mutex);
+    }
+    return NULL;
+}
+
+static double run(void *(*worker)(void *), size_t thread_count) {
+    pthread_t threads[16];
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < thread_count; i++) {
+        if (pthread_create(&threads[i], NULL, worker, (void *)(uintptr_t)i) != 0) {
+            fprintf(stderr, "pthread_create failed\n");
+            exit(1);
+        }
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    return thread_count * (double)operations / seconds / 1e6;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) operations = strtoull(argv[1], NULL, 10);
+    if (argc > 2) keys = atoi(argv[2]);
+    if (keys <= 0) keys = 1;
+    printf("%zu operations per thread on %d keys, Mops/s\n", operations, keys);
+    printf("%-8s %12s %12s\n", "threads", "mutex", "lock-free");
+    size_t thread_counts[] = {1, 2, 4, 8, 16};
+    for (size_t i = 0; i < sizeof(thread_counts) / sizeof(thread_counts[0]); i++) {
+        set = LinkedList_init_lockfree(int, int_comparator);
+        list = LinkedList_init(int);
+        for (int key = 0; key < keys; key += 2) {
+            LinkedList_lockfree_insert_sorted(set, &key);
+            LinkedList_push(&list, key);
+        }
+        double mutex_rate = run(mutex_worker, thread_counts[i]);
+        double lockfree_rate = run(lockfree_worker, thread_counts[i]);
+        printf("%-8zu %12.2f %12.2f\n", thread_counts[i], mutex_rate, lockfree_rate);
+        LinkedList_lockfree_destroy(&set);
+        LinkedList_destroy(&list);
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+// Compares LinkedList_radix_sort with LinkedList_sort on lists of random unsigned keys.
+// Build the libraries with `make export` at the root, then in this directory:
+//     make compile files=bench_radix_sort.c executable_file=bench_radix_sort CFLAGS="-O2 -pthread" && ./bin/bench_radix_sort [length]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <linkedList.h>
+
+int uint32_ordering_comparator(uint32_t a, uint32_t b) { return (a > b) - (a < b); }
+int uint64_ordering_comparator(uint64_t a, uint64_t b) { return (a > b) - (a < b); }
+uint64_t uint32_key(const void *element) { return *(const uint32_t *)element; }
+uint64_t uint64_key(const void *element) { return *(const uint64_t *)element; }
+
+// the same pseudo random sequence for every run, so both sorts get the same list
+static uint64_t random_state;
+static uint64_t next_random(void) {
+    random_state = random_state * 6364136223846793005ull + 1442695040888963407ull;
+    return random_state >> 7;
+}
+
+static double elapsed_ms(struct timespec start) {
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+#define BENCHMARK(__type__, __name__, __sort__) do { \
+    __type__ *list = LinkedList_init(__type__); \
+    random_state = 1; \
+    for (size_t i = 0; i < length; i++) { \
+        LinkedList_push(&list, (__type__)next_random()); \
+    } \
+    struct timespec start; \
+    clock_gettime(CLOCK_MONOTONIC, &start); \
+    __sort__; \
+    double ms = elapsed_ms(start); \
+    __type__ previous = 0; \
+    for (size_t i = 0; i < length; i++) { \
+        __type__ value = LinkedList_pop_front(&list); \
+        if (value < previous) { \
+            fprintf(stderr, "%s: not sorted\n", __name__); \
+            exit(1); \
+        } \
+        previous = value; \
+    } \
+    printf("%-30s %9.1f ms\n", __name__, ms); \
+    LinkedList_destroy(&list); \
+} while (0)
+
+int main(int argc, char **argv) {
+    size_t length = (argc > 1) ? strtoull(argv[1], NULL, 10) : 1000000;
+    printf("%zu random keys\n", length);
+    BENCHMARK(uint32_t, "uint32 LinkedList_sort", LinkedList_sort(&list, uint32_ordering_comparator));
+    BENCHMARK(uint32_t, "uint32 LinkedList_radix_sort", LinkedList_radix_sort(&list, uint32_key, 32));
+    BENCHMARK(uint64_t, "uint64 LinkedList_sort", LinkedList_sort(&list, uint64_ordering_comparator));
+    BENCHMARK(uint64_t, "uint64 LinkedList_radix_sort", LinkedList_radix_sort(&list, uint64_key, 64));
+    return 0;
+}
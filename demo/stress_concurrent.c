@@ -0,0 +1,168 @@
+// Checks the concurrent list under threads that mix every operation on it.
+// Every value written to the list is unique and every thread records the values it wrote and the values it removed: once the threads are
+// joined, each value removed or left in the list must have been written and seen only once, and the length must be the number of
+// insertions minus the number of removals (a set overwrites an element, it doesn't change the length).
+// Build the libraries with `make export` at the root, then in this directory (add -fsanitize=thread to CFLAGS to run it under TSan):
+//     make compile files=stress_concurrent.c executable_file=stress_concurrent CFLAGS="-O2 -pthread" && ./bin/stress_concurrent [threads] [operations per thread]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <linkedList.h>
+
+#define MAX_THREADS 64
+
+typedef struct Worker {
+    size_t id;
+    pthread_t thread;
+    bool *written; // by operation index, whether the value of the operation got into the list
+    int64_t *removed; // the values removed by the thread
+    size_t removed_count;
+    size_t inserted_count;
+    size_t wrong_reads;
+} Worker;
+
+static size_t operations = 50000;
+static size_t thread_count = 8;
+static LinkedListConcurrent *list;
+
+bool int64_equals(const void *element, const void *value) { return *(const int64_t *)element == *(const int64_t *)value; }
+
+static void count_element(const void *element, void *context) { (void)element; (*(size_t *)context)++; }
+
+// the value written by the operation i of the thread id, unique across the run
+static int64_t value_of(size_t id, size_t i) { return (int64_t)(id * operations + i); }
+
+static bool is_value(int64_t value) { return (value >= 0) && (value < (int64_t)(thread_count * operations)); }
+
+static void inserted(Worker *worker, size_t i) {
+    worker->written[i] = true;
+    worker->inserted_count++;
+}
+
+static void removed(Worker *worker, int64_t value) { worker->removed[worker->removed_count++] = value; }
+
+static void *work(void *arg) {
+    Worker *worker = arg;
+    uint32_t state = (uint32_t)worker->id * 7919u + 1u;
+    for (size_t i = 0; i < operations; i++) {
+        state = state * 1103515245u + 12345u;
+        uint32_t random = state >> 8;
+        size_t index = (random >> 8) % 16;
+        int64_t value = value_of(worker->id, i), element;
+        switch (random % 12) {
+            case 0: LinkedList_concurrent_push(list, &value); inserted(worker, i); break;
+            case 1: LinkedList_concurrent_push_front(list, &value); inserted(worker, i); break;
+            case 2: if (LinkedList_concurrent_insert_at(list, index, &value)) inserted(worker, i); break;
+            // the removals outnumber the insertions, a second push keeps a few dozen elements in the list
+            case 3: if (LinkedList_concurrent_length(list) < 64) { LinkedList_concurrent_push(list, &value); inserted(worker, i); } break;
+            case 4: worker->written[i] = LinkedList_concurrent_set(list, index, &value); break;
+            case 5:
+                if (LinkedList_concurrent_get(list, index, &element) && !is_value(element)) worker->wrong_reads++;
+                break;
+            case 6: if (LinkedList_concurrent_pop(list, &element)) removed(worker, element); break;
+            case 7: if (LinkedList_concurrent_pop_front(list, &element)) removed(worker, element); break;
+            case 8: if (LinkedList_concurrent_remove_at(list, index, &element)) removed(worker, element); break;
+            case 9: {
+                // one of the values the thread wrote a little earlier, it may have been removed or overwritten already
+                int64_t earlier = value_of(worker->id, (i >= 16) ? i - 16 + index : index);
+                if (LinkedList_concurrent_remove_value(list, &earlier, int64_equals) != LINKEDLIST_NOT_FOUND) removed(worker, earlier);
+                break;
+            }
+            case 10: LinkedList_concurrent_find(list, &value, int64_equals); break;
+            default: {
+                size_t count = 0;
+                LinkedList_concurrent_foreach(list, count_element, &count);
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) thread_count = strtoull(argv[1], NULL, 10);
+    if (argc > 2) operations = strtoull(argv[2], NULL, 10);
+    if ((thread_count == 0) || (thread_count > MAX_THREADS)) {
+        fprintf(stderr, "the number of threads must be in [1, %d]\n", MAX_THREADS);
+        return 1;
+    }
+    list = LinkedList_init_concurrent(int64_t);
+    Worker workers[MAX_THREADS];
+    for (size_t i = 0; i < thread_count; i++) {
+        workers[i] = (Worker){ .id = i };
+        workers[i].written = calloc(operations, sizeof(bool));
+        workers[i].removed = malloc(operations * sizeof(int64_t));
+        if ((workers[i].written == NULL) || (workers[i].removed == NULL)) {
+            fprintf(stderr, "malloc failed\n");
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        if (pthread_create(&workers[i].thread, NULL, work, &workers[i]) != 0) {
+            fprintf(stderr, "pthread_create failed\n");
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    size_t errors = 0, inserted_total = 0, removed_total = 0;
+    // how many times every value was removed or found left in the list
+    size_t *seen = calloc(thread_count * operations, sizeof(size_t));
+    if (seen == NULL) {
+        fprintf(stderr, "malloc failed\n");
+        return 1;
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        inserted_total += workers[i].inserted_count;
+        removed_total += workers[i].removed_count;
+        for (size_t j = 0; j < workers[i].removed_count; j++) {
+            int64_t value = workers[i].removed[j];
+            if (!is_value(value)) {
+                fprintf(stderr, "thread %zu: removed %lld, never written\n", i, (long long)value);
+                errors++;
+            } else {
+                seen[value]++;
+            }
+        }
+        if (workers[i].wrong_reads != 0) {
+            fprintf(stderr, "thread %zu: %zu reads returned a value never written\n", i, workers[i].wrong_reads);
+            errors++;
+        }
+    }
+    size_t length = LinkedList_concurrent_length(list), left = 0;
+    int64_t value;
+    while (LinkedList_concurrent_pop_front(list, &value)) {
+        left++;
+        if (!is_value(value)) {
+            fprintf(stderr, "%lld left in the list, never written\n", (long long)value);
+            errors++;
+        } else {
+            seen[value]++;
+        }
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        for (size_t j = 0; j < operations; j++) {
+            size_t count = seen[value_of(i, j)];
+            if ((count > 1) || ((count == 1) && !workers[i].written[j])) {
+                fprintf(stderr, "value %lld: seen %zu times, %s\n", (long long)value_of(i, j), count, workers[i].written[j] ? "written" : "never written");
+                errors++;
+            }
+        }
+    }
+    if ((left != length) || (inserted_total - removed_total != length)) {
+        fprintf(stderr, "length %zu, %zu elements left, %zu insertions and %zu removals\n", length, left, inserted_total, removed_total);
+        errors++;
+    }
+    free(seen);
+    for (size_t i = 0; i < thread_count; i++) {
+        free(workers[i].written);
+        free(workers[i].removed);
+    }
+    LinkedList_concurrent_destroy(&list);
+    if (errors != 0) return 1;
+    printf("%zu threads, %zu operations each: ok\n", thread_count, operations);
+    return 0;
+}
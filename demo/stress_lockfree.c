@@ -0,0 +1,94 @@
+// Checks the lock-free sorted set under concurrent insertions, removals and lookups.
+// Every thread counts the insertions and removals that succeeded per key: once the threads are joined, each key must have been
+// inserted as many times as it was removed, or once more if it is still in the set, and the length must match.
+// Build the libraries with `make export` at the root, then in this directory (add -fsanitize=thread to CFLAGS to run it under TSan):
+//     make compile files=stress_lockfree.c executable_file=stress_lockfree CFLAGS="-O2 -pthread" && ./bin/stress_lockfree [threads] [operations per thread]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <linkedList.h>
+
+#define MAX_THREADS 64
+#define KEYS 256
+
+int int_comparator(const void *a, const void *b) { int x = *(const int *)a, y = *(const int *)b; return (x > y) - (x < y); }
+
+static size_t operations = 100000;
+static LinkedListLockFree *set;
+static long inserted[MAX_THREADS][KEYS], removed[MAX_THREADS][KEYS];
+static long wrong_removals[MAX_THREADS];
+
+static void *worker(void *arg) {
+    size_t id = (size_t)(uintptr_t)arg;
+    uint32_t state = (uint32_t)id * 7919u + 1u;
+    for (size_t i = 0; i < operations; i++) {
+        state = state * 1103515245u + 12345u;
+        uint32_t random = state >> 8;
+        int key = (int)(random % KEYS);
+        switch ((random >> 12) % 4) {
+            case 0:
+                if (LinkedList_lockfree_insert_sorted(set, &key)) inserted[id][key]++;
+                break;
+            case 1: {
+                int element = -1;
+                if (LinkedList_lockfree_remove_value(set, &key, &element)) {
+                    removed[id][key]++;
+                    if (element != key) wrong_removals[id]++;
+                }
+                break;
+            }
+            default:
+                LinkedList_lockfree_contains(set, &key);
+                break;
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    size_t thread_count = (argc > 1) ? strtoull(argv[1], NULL, 10) : 8;
+    if (argc > 2) operations = strtoull(argv[2], NULL, 10);
+    if ((thread_count == 0) || (thread_count > MAX_THREADS)) {
+        fprintf(stderr, "the number of threads must be in [1, %d]\n", MAX_THREADS);
+        return 1;
+    }
+    set = LinkedList_init_lockfree(int, int_comparator);
+    pthread_t threads[MAX_THREADS];
+    for (size_t i = 0; i < thread_count; i++) {
+        if (pthread_create(&threads[i], NULL, worker, (void *)(uintptr_t)i) != 0) {
+            fprintf(stderr, "pthread_create failed\n");
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    size_t errors = 0, length = 0;
+    for (int key = 0; key < KEYS; key++) {
+        long balance = 0;
+        for (size_t i = 0; i < thread_count; i++) {
+            balance += inserted[i][key] - removed[i][key];
+        }
+        bool present = LinkedList_lockfree_contains(set, &key);
+        if (((balance != 0) && (balance != 1)) || (present != (balance == 1))) {
+            fprintf(stderr, "key %d: %ld more insertions than removals, %s the set\n", key, balance, present ? "in" : "not in");
+            errors++;
+        }
+        length += present;
+    }
+    for (size_t i = 0; i < thread_count; i++) {
+        if (wrong_removals[i] != 0) {
+            fprintf(stderr, "thread %zu: %ld removals returned another element\n", i, wrong_removals[i]);
+            errors++;
+        }
+    }
+    if (LinkedList_lockfree_length(set) != length) {
+        fprintf(stderr, "length %zu, %zu elements found\n", LinkedList_lockfree_length(set), length);
+        errors++;
+    }
+    LinkedList_lockfree_destroy(&set);
+    if (errors != 0) return 1;
+    printf("%zu threads, %zu operations each: ok\n", thread_count, operations);
+    return 0;
+}
@@ -0,0 +1,76 @@
+// Checks the multi-producer single-consumer queue under producers pushing while the consumer alternates between pop and pop_batch.
+// Every producer pushes its own numbers in increasing order: the consumer must receive the numbers of every producer in that order,
+// none missing nor repeated, and the queue must be empty once the producers are joined and everything was received.
+// Build the libraries with `make export` at the root, then in this directory (add -fsanitize=thread to CFLAGS to run it under TSan):
+//     make compile files=stress_mpsc.c executable_file=stress_mpsc CFLAGS="-O2 -pthread" && ./bin/stress_mpsc [producers] [elements per producer]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <linkedList.h>
+
+#define MAX_PRODUCERS 64
+#define BATCH_SIZE 64
+
+typedef struct Message {
+    size_t producer;
+    size_t sequence;
+} Message;
+
+static size_t elements = 200000;
+static LinkedListMPSC *queue;
+
+static void *produce(void *arg) {
+    Message message = { (size_t)(uintptr_t)arg, 0 };
+    for ( ; message.sequence < elements; message.sequence++) {
+        LinkedList_mpsc_push(queue, &message);
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+    size_t producer_count = (argc > 1) ? strtoull(argv[1], NULL, 10) : 4;
+    if (argc > 2) elements = strtoull(argv[2], NULL, 10);
+    if ((producer_count == 0) || (producer_count > MAX_PRODUCERS)) {
+        fprintf(stderr, "the number of producers must be in [1, %d]\n", MAX_PRODUCERS);
+        return 1;
+    }
+    queue = LinkedList_init_mpsc(Message);
+    pthread_t producers[MAX_PRODUCERS];
+    for (size_t i = 0; i < producer_count; i++) {
+        if (pthread_create(&producers[i], NULL, produce, (void *)(uintptr_t)i) != 0) {
+            fprintf(stderr, "pthread_create failed\n");
+            return 1;
+        }
+    }
+
+    // the next sequence number expected from every producer
+    size_t expected[MAX_PRODUCERS] = {0};
+    size_t errors = 0, received = 0, total = producer_count * elements;
+    Message batch[BATCH_SIZE];
+    for (size_t round = 0; (received < total) && (errors == 0); round++) {
+        size_t count = (round % 2 == 0) ? (LinkedList_mpsc_pop(queue, &batch[0]) ? 1 : 0) : LinkedList_mpsc_pop_batch(queue, BATCH_SIZE, batch);
+        for (size_t i = 0; i < count; i++) {
+            size_t producer = batch[i].producer;
+            if ((producer >= producer_count) || (batch[i].sequence != expected[producer])) {
+                fprintf(stderr, "received %zu from producer %zu, expected %zu\n", batch[i].sequence, producer,
+                    (producer < producer_count) ? expected[producer] : 0);
+                errors++;
+                break;
+            }
+            expected[producer]++;
+        }
+        received += count;
+    }
+    for (size_t i = 0; i < producer_count; i++) {
+        pthread_join(producers[i], NULL);
+    }
+    if ((errors == 0) && LinkedList_mpsc_pop(queue, NULL)) {
+        fprintf(stderr, "the queue is not empty after %zu elements\n", total);
+        errors++;
+    }
+    LinkedList_mpsc_destroy(&queue);
+    if (errors != 0) return 1;
+    printf("%zu producers, %zu elements each: ok\n", producer_count, elements);
+    return 0;
+}
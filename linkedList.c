@@ -1,6 +1,9 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sched.h>
 
 #include "./modules/system_env/system_env.h"
 #include "./linkedList.h"
@@ -23,9 +26,75 @@ LinkedList *__linkedlist_init(size_t element_size) {
     list->length = 0;
     list->element_size = element_size;
     list->cached_index = 0;
+    list->share = NULL;
     return list;
 }
 
+LinkedList *__linkedlist_cow_copy(void *list_ptr) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    if ((*temp_list)->share == NULL) {
+        (*temp_list)->share = malloc(sizeof(__LinkedListShare));
+        assert((*temp_list)->share != NULL);
+        (*temp_list)->share->reference_count = 1;
+    }
+    LinkedList *list = __linkedlist_init((*temp_list)->element_size);
+    list->head = (*temp_list)->head;
+    list->tail = (*temp_list)->tail;
+    list->length = (*temp_list)->length;
+    list->share = (*temp_list)->share;
+    __atomic_fetch_add(&list->share->reference_count, 1, __ATOMIC_ACQ_REL);
+    return list;
+}
+
+void __linkedlist_detach(LinkedList *list) {
+    if (list->share == NULL) {
+        return;
+    }
+    if (__atomic_load_n(&list->share->reference_count, __ATOMIC_ACQUIRE) == 1) {
+        free(list->share);
+        list->share = NULL;
+        return;
+    }
+    // the shared nodes are copied before the reference is dropped, the other owners may free them as soon as it is
+    __Node *shared_head = list->head;
+    __Node *current_node = shared_head;
+    __Node *cached = list->cached;
+    list->head = NULL;
+    list->tail = NULL;
+    list->cached = NULL;
+    while (current_node != NULL) {
+        __Node *node = __node_init(list->element_size);
+        memcpy(node->element, current_node->element, list->element_size);
+        node->previous = list->tail;
+        if (list->head == NULL) {
+            list->head = node;
+        } else {
+            list->tail->next = node;
+        }
+        list->tail = node;
+        if (current_node == cached) {
+            list->cached = node;
+        }
+        current_node = current_node->next;
+    }
+    if (__linkedlist_release(list)) {
+        __node_free_chain(shared_head);
+    }
+}
+
+bool __linkedlist_release(LinkedList *list) {
+    if (list->share == NULL) {
+        return true;
+    }
+    bool last_owner = __atomic_sub_fetch(&list->share->reference_count, 1, __ATOMIC_ACQ_REL) == 0;
+    if (last_owner) {
+        free(list->share);
+    }
+    list->share = NULL;
+    return last_owner;
+}
+
 size_t LinkedList_length(void *list_ptr) {
     LinkedList **temp_list = list_ptr;
     assert((temp_list != NULL) && (*temp_list != NULL));
@@ -90,3 +159,1925 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
     if (result_index != NULL) { *result_index = (*temp_list)->cached_index; }
     *direction = index >= (*temp_list)->cached_index ? 1 : -1;
 }
+
+__Node *__linkedlist_node_at(void *list_ptr, size_t index) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(index < (*temp_list)->length);
+    __Node *node = NULL;
+    int direction = 0;
+    size_t node_index = 0;
+    __linkedlist_locate_nearest_node(list_ptr, index, &node, &direction, &node_index);
+    while (node_index != index) {
+        if (direction == 1) {
+            node = node->next;
+            node_index++;
+        } else {
+            node = node->previous;
+            node_index--;
+        }
+    }
+    (*temp_list)->cached = node;
+    (*temp_list)->cached_index = index;
+    return node;
+}
+
+void __linkedlist_insert_node(void *list_ptr, size_t index, __Node *node) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(index <= (*temp_list)->length);
+    assert(node != NULL);
+    LinkedList *list = *temp_list;
+    __linkedlist_detach(list);
+    if (index == list->length) {
+        node->next = NULL;
+        node->previous = list->tail;
+        if (list->tail != NULL) {
+            list->tail->next = node;
+        } else {
+            list->head = node;
+        }
+        list->tail = node;
+    } else if (index == 0) {
+        node->previous = NULL;
+        node->next = list->head;
+        list->head->previous = node;
+        list->head = node;
+        list->cached_index++;
+    } else {
+        __Node *next_node = __linkedlist_node_at(list_ptr, index);
+        node->next = next_node;
+        node->previous = next_node->previous;
+        next_node->previous->next = node;
+        next_node->previous = node;
+        list->cached = node;
+        list->cached_index = index;
+    }
+    list->length++;
+}
+
+void *__linkedlist_emplace_at(void *list_ptr, size_t index) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    __Node *node = __node_init((*temp_list)->element_size);
+    __linkedlist_insert_node(list_ptr, index, node);
+    return node->element;
+}
+
+void LinkedList_push_ptr(void *list_ptr, const void *element) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(element != NULL);
+    __Node *node = __node_init((*temp_list)->element_size);
+    memcpy(node->element, element, (*temp_list)->element_size);
+    __linkedlist_insert_node(list_ptr, (*temp_list)->length, node);
+}
+
+typedef struct __LinkedListBatchEntry {
+    size_t index;
+    size_t position; // in the caller's array
+} __LinkedListBatchEntry;
+
+static int __linkedlist_compare_batch_entries(const void *a, const void *b) {
+    const __LinkedListBatchEntry *entry_a = a;
+    const __LinkedListBatchEntry *entry_b = b;
+    if (entry_a->index != entry_b->index) {
+        return entry_a->index < entry_b->index ? -1 : 1;
+    }
+    return entry_a->position < entry_b->position ? -1 : (entry_a->position > entry_b->position);
+}
+
+// Returns the positions of the batch sorted by index (then by position, so repeated indices keep the caller's order),
+// or NULL when the indices are already ascending, or when malloc fails, the batch then gets visited in the caller's order.
+static __LinkedListBatchEntry *__linkedlist_batch_order(const size_t *indices, size_t count, size_t bound) {
+    bool ascending = true;
+    for (size_t i = 0; i < count; i++) {
+        assert(indices[i] < bound);
+        if (i > 0 && indices[i] < indices[i - 1]) {
+            ascending = false;
+        }
+    }
+    if (ascending) return NULL;
+
+    __LinkedListBatchEntry *entries = malloc(count * sizeof(__LinkedListBatchEntry));
+    if (entries == NULL) return NULL;
+    for (size_t i = 0; i < count; i++) {
+        entries[i].index = indices[i];
+        entries[i].position = i;
+    }
+    qsort(entries, count, sizeof(__LinkedListBatchEntry), __linkedlist_compare_batch_entries);
+    return entries;
+}
+
+void LinkedList_get_many(void *list_ptr, const size_t *indices, size_t count, void *elements) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    if (count == 0) return;
+    assert((indices != NULL) && (elements != NULL));
+    LinkedList *list = *temp_list;
+    __LinkedListBatchEntry *entries = __linkedlist_batch_order(indices, count, list->length);
+    for (size_t i = 0; i < count; i++) {
+        size_t position = (entries != NULL) ? entries[i].position : i;
+        // the previous index is cached, so every node is reached from it (or from the tail when that is nearer)
+        __Node *node = __linkedlist_node_at(list_ptr, indices[position]);
+        memcpy((char *)elements + position * list->element_size, node->element, list->element_size);
+    }
+    free(entries);
+}
+
+void LinkedList_set_many(void *list_ptr, const size_t *indices, size_t count, const void *elements) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    if (count == 0) return;
+    assert((indices != NULL) && (elements != NULL));
+    LinkedList *list = *temp_list;
+    __linkedlist_detach(list);
+    __LinkedListBatchEntry *entries = __linkedlist_batch_order(indices, count, list->length);
+    for (size_t i = 0; i < count; i++) {
+        size_t position = (entries != NULL) ? entries[i].position : i;
+        __Node *node = __linkedlist_node_at(list_ptr, indices[position]);
+        memcpy(node->element, (const char *)elements + position * list->element_size, list->element_size);
+    }
+    free(entries);
+}
+
+void LinkedList_insert_many(void *list_ptr, const size_t *positions, const void *elements, size_t count) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    if (count == 0) return;
+    assert((positions != NULL) && (elements != NULL));
+    LinkedList *list = *temp_list;
+    __linkedlist_detach(list);
+    __LinkedListBatchEntry *entries = __linkedlist_batch_order(positions, count, list->length + 1);
+    if (entries == NULL) {
+        for (size_t i = 1; i < count; i++) {
+            assert(positions[i] >= positions[i - 1]); // otherwise sorting them needed malloc, which failed
+        }
+    }
+
+    // next_node is the node at the original index position (NULL past the tail), new nodes only go before it, so walking from it skips them
+    size_t position = positions[(entries != NULL) ? entries[0].position : 0];
+    __Node *next_node = NULL;
+    if (position < list->length) {
+        next_node = __linkedlist_node_at(list_ptr, position);
+    }
+    __Node *node = NULL;
+    for (size_t i = 0; i < count; i++) {
+        size_t element_position = (entries != NULL) ? entries[i].position : i;
+        while (position < positions[element_position]) {
+            next_node = next_node->next;
+            position++;
+        }
+        // every node is its own allocation, the rest of the list frees them one by one
+        node = __node_init(list->element_size);
+        memcpy(node->element, (const char *)elements + element_position * list->element_size, list->element_size);
+        node->next = next_node;
+        node->previous = (next_node != NULL) ? next_node->previous : list->tail;
+        if (node->previous != NULL) {
+            node->previous->next = node;
+        } else {
+            list->head = node;
+        }
+        if (next_node != NULL) {
+            next_node->previous = node;
+        } else {
+            list->tail = node;
+        }
+        list->length++;
+    }
+    free(entries);
+    // the last new node has every other new node before it
+    list->cached = node;
+    list->cached_index = position + count - 1;
+}
+
+void LinkedList_rotate(void *list_ptr, ptrdiff_t steps) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    LinkedList *list = *temp_list;
+    if (list->length < 2) return;
+    size_t shift = (size_t)(steps % (ptrdiff_t)list->length + (ptrdiff_t)list->length) % list->length;
+    if (shift == 0) return;
+    __linkedlist_detach(list);
+    __Node *cached = list->cached;
+    size_t cached_index = list->cached_index;
+    __Node *new_head = __linkedlist_node_at(list_ptr, shift);
+
+    // close the ring, then open it before the new head
+    list->tail->next = list->head;
+    list->head->previous = list->tail;
+    list->head = new_head;
+    list->tail = new_head->previous;
+    list->head->previous = NULL;
+    list->tail->next = NULL;
+    if (cached != NULL) {
+        list->cached = cached;
+        list->cached_index = (cached_index + list->length - shift) % list->length;
+    } else {
+        list->cached = new_head;
+        list->cached_index = 0;
+    }
+}
+
+void LinkedList_swap(void *list_ptr, size_t index1, size_t index2) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    LinkedList *list = *temp_list;
+    assert((index1 < list->length) && (index2 < list->length));
+    if (index1 == index2) return;
+    if (index1 > index2) {
+        size_t index = index1;
+        index1 = index2;
+        index2 = index;
+    }
+    __linkedlist_detach(list);
+    __Node *first = __linkedlist_node_at(list_ptr, index1);
+    __Node *second = __linkedlist_node_at(list_ptr, index2);
+
+    __Node *first_previous = first->previous;
+    __Node *second_next = second->next;
+    if (first->next == second) {
+        second->previous = first_previous;
+        second->next = first;
+        first->previous = second;
+        first->next = second_next;
+    } else {
+        __Node *first_next = first->next;
+        __Node *second_previous = second->previous;
+        second->previous = first_previous;
+        second->next = first_next;
+        first_next->previous = second;
+        first->previous = second_previous;
+        first->next = second_next;
+        second_previous->next = first;
+    }
+    if (first_previous != NULL) {
+        first_previous->next = second;
+    } else {
+        list->head = second;
+    }
+    if (second_next != NULL) {
+        second_next->previous = first;
+    } else {
+        list->tail = first;
+    }
+    list->cached = second;
+    list->cached_index = index1;
+}
+
+void LinkedList_move(void *list_ptr, size_t from, size_t to) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    LinkedList *list = *temp_list;
+    assert((from < list->length) && (to < list->length));
+    if (from == to) return;
+    __linkedlist_detach(list);
+    __Node *node = __linkedlist_node_at(list_ptr, from);
+
+    if (node->previous != NULL) {
+        node->previous->next = node->next;
+    } else {
+        list->head = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->previous = node->previous;
+    } else {
+        list->tail = node->previous;
+    }
+    // keep a cached node near the destination to walk from
+    list->cached = (node->next != NULL) ? node->next : node->previous;
+    list->cached_index = (node->next != NULL) ? from : from - 1;
+    list->length--;
+    __linkedlist_insert_node(list_ptr, to, node);
+    list->cached = node;
+    list->cached_index = to;
+}
+
+size_t LinkedList_pop_front_n(void *list_ptr, size_t count, void *elements) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    LinkedList *list = *temp_list;
+    if (count > list->length) {
+        count = list->length;
+    }
+    if (count == 0) return 0;
+    __linkedlist_detach(list);
+
+    __Node *removed = list->head;
+    __Node *last = removed;
+    for (size_t i = 0; i < count; i++) {
+        if (elements != NULL) {
+            memcpy((char *)elements + i * list->element_size, last->element, list->element_size);
+        }
+        if (i + 1 < count) {
+            last = last->next;
+        }
+    }
+    list->head = last->next;
+    last->next = NULL;
+    if (list->head != NULL) {
+        list->head->previous = NULL;
+    } else {
+        list->tail = NULL;
+    }
+    if (list->cached != NULL) {
+        if (list->cached_index < count) {
+            list->cached = list->head;
+            list->cached_index = 0;
+        } else {
+            list->cached_index -= count;
+        }
+    }
+    list->length -= count;
+    __node_free_chain(removed);
+    return count;
+}
+
+void *__linkedlist_element_ref(void *list_ptr, size_t index) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    __linkedlist_detach(*temp_list);
+    return __linkedlist_node_at(list_ptr, index)->element;
+}
+
+void *__linkedlist_front_ref(void *list_ptr) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert((*temp_list)->length > 0);
+    __linkedlist_detach(*temp_list);
+    return (*temp_list)->head->element;
+}
+
+void *__linkedlist_back_ref(void *list_ptr) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert((*temp_list)->length > 0);
+    __linkedlist_detach(*temp_list);
+    return (*temp_list)->tail->element;
+}
+
+size_t __linkedlist_min_run_length(size_t length) {
+    // insertion sorting a linked list can't use binary search, so the runs are kept shorter than TimSort's 32 to 64
+    size_t remainder = 0;
+    while (length >= 16) {
+        remainder |= length & 1;
+        length >>= 1;
+    }
+    return length + remainder;
+}
+
+static void __linkedlist_swap_nodes(__Node **a, __Node **b) {
+    __Node *temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void __linkedlist_sift_down_nodes(__Node **nodes, size_t root, size_t count, int (*ordering_comparator)(const void *, const void *)) {
+    size_t child;
+    while ((child = 2 * root + 1) < count) {
+        if (child + 1 < count && ordering_comparator(nodes[child]->element, nodes[child + 1]->element) < 0) {
+            child++;
+        }
+        if (ordering_comparator(nodes[root]->element, nodes[child]->element) >= 0) {
+            return;
+        }
+        __linkedlist_swap_nodes(&nodes[root], &nodes[child]);
+        root = child;
+    }
+}
+
+static void __linkedlist_heap_sort_nodes(__Node **nodes, size_t count, int (*ordering_comparator)(const void *, const void *)) {
+    for (size_t root = count / 2; root-- > 0; ) {
+        __linkedlist_sift_down_nodes(nodes, root, count, ordering_comparator);
+    }
+    for (size_t end = count - 1; end > 0; end--) {
+        __linkedlist_swap_nodes(&nodes[0], &nodes[end]);
+        __linkedlist_sift_down_nodes(nodes, 0, end, ordering_comparator);
+    }
+}
+
+static void __linkedlist_insertion_sort_nodes(__Node **nodes, size_t count, int (*ordering_comparator)(const void *, const void *)) {
+    for (size_t i = 1; i < count; i++) {
+        __Node *node = nodes[i];
+        size_t j = i;
+        while (j > 0 && ordering_comparator(nodes[j - 1]->element, node->element) > 0) {
+            nodes[j] = nodes[j - 1];
+            j--;
+        }
+        nodes[j] = node;
+    }
+}
+
+static void __linkedlist_introsort_nodes(__Node **nodes, size_t count, size_t depth_limit, int (*ordering_comparator)(const void *, const void *)) {
+    while (count > 16) {
+        if (depth_limit == 0) {
+            // the partitions keep coming out unbalanced, heap sort guarantees O(n log n)
+            __linkedlist_heap_sort_nodes(nodes, count, ordering_comparator);
+            return;
+        }
+        depth_limit--;
+
+        // median of three, which also leaves sentinels at both ends for the partition loops
+        size_t middle = count / 2, last = count - 1;
+        if (ordering_comparator(nodes[middle]->element, nodes[0]->element) < 0) __linkedlist_swap_nodes(&nodes[middle], &nodes[0]);
+        if (ordering_comparator(nodes[last]->element, nodes[middle]->element) < 0) {
+            __linkedlist_swap_nodes(&nodes[last], &nodes[middle]);
+            if (ordering_comparator(nodes[middle]->element, nodes[0]->element) < 0) __linkedlist_swap_nodes(&nodes[middle], &nodes[0]);
+        }
+        const void *pivot = nodes[middle]->element;
+
+        size_t i = 0, j = last;
+        while (true) {
+            do { i++; } while (ordering_comparator(nodes[i]->element, pivot) < 0);
+            do { j--; } while (ordering_comparator(pivot, nodes[j]->element) < 0);
+            if (i >= j) break;
+            __linkedlist_swap_nodes(&nodes[i], &nodes[j]);
+        }
+
+        // recurse into the smaller half and loop on the larger one, so the stack stays O(log n)
+        size_t left_count = j + 1;
+        if (left_count < count - left_count) {
+            __linkedlist_introsort_nodes(nodes, left_count, depth_limit, ordering_comparator);
+            nodes += left_count;
+            count -= left_count;
+        } else {
+            __linkedlist_introsort_nodes(nodes + left_count, count - left_count, depth_limit, ordering_comparator);
+            count = left_count;
+        }
+    }
+    __linkedlist_insertion_sort_nodes(nodes, count, ordering_comparator);
+}
+
+void LinkedList_sort_fast(void *list_ptr, int (*ordering_comparator)(const void *, const void *)) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(ordering_comparator != NULL);
+    LinkedList *list = *temp_list;
+    if (list->length < 2) return;
+
+    __Node **nodes = malloc(list->length * sizeof(__Node *));
+    if (nodes == NULL) {
+        __LinkedList_sort__(temp_list, ordering_comparator, void, __LinkedList_compare_erased__);
+        return;
+    }
+    __linkedlist_detach(list);
+
+    size_t i = 0;
+    for (__Node *curr = list->head; curr != NULL; curr = curr->next) {
+        nodes[i++] = curr;
+    }
+    size_t depth_limit = 0;
+    for (size_t length = list->length; length > 1; length >>= 1) {
+        depth_limit += 2;
+    }
+    __linkedlist_introsort_nodes(nodes, list->length, depth_limit, ordering_comparator);
+
+    nodes[0]->previous = NULL;
+    for (i = 1; i < list->length; i++) {
+        nodes[i - 1]->next = nodes[i];
+        nodes[i]->previous = nodes[i - 1];
+    }
+    nodes[list->length - 1]->next = NULL;
+    list->head = nodes[0];
+    list->tail = nodes[list->length - 1];
+    list->cached = NULL;
+    free(nodes);
+}
+
+static uint64_t __linkedlist_radix_key_mask(unsigned key_bits) {
+    return (key_bits == 64) ? UINT64_MAX : ((uint64_t)1 << key_bits) - 1;
+}
+
+typedef struct __LinkedListRadixItem {
+    uint64_t key;
+    __Node *node;
+} __LinkedListRadixItem;
+
+static void __linkedlist_radix_sort_items(LinkedList *list, __LinkedListRadixItem *items, uint64_t (*key)(const void *element), unsigned key_bits) {
+    size_t length = list->length;
+    size_t passes = (key_bits + 7) / 8;
+    uint64_t mask = __linkedlist_radix_key_mask(key_bits);
+    size_t counts[8][256] = {0};
+    size_t i = 0;
+    for (__Node *curr = list->head; curr != NULL; curr = curr->next, i++) {
+        items[i].key = key(curr->element) & mask;
+        items[i].node = curr;
+        for (size_t pass = 0; pass < passes; pass++) {
+            counts[pass][(items[i].key >> (8 * pass)) & 0xff]++;
+        }
+    }
+
+    __LinkedListRadixItem *source = items;
+    __LinkedListRadixItem *destination = items + length;
+    for (size_t pass = 0; pass < passes; pass++) {
+        unsigned shift = 8 * pass;
+        // every key has the same digit, the pass wouldn't move anything
+        if (counts[pass][(source[0].key >> shift) & 0xff] == length) continue;
+        size_t offset = 0;
+        for (size_t digit = 0; digit < 256; digit++) {
+            size_t count = counts[pass][digit];
+            counts[pass][digit] = offset;
+            offset += count;
+        }
+        for (i = 0; i < length; i++) {
+            destination[counts[pass][(source[i].key >> shift) & 0xff]++] = source[i];
+        }
+        __LinkedListRadixItem *temp = source;
+        source = destination;
+        destination = temp;
+    }
+
+    source[0].node->previous = NULL;
+    for (i = 1; i < length; i++) {
+        source[i - 1].node->next = source[i].node;
+        source[i].node->previous = source[i - 1].node;
+    }
+    source[length - 1].node->next = NULL;
+    list->head = source[0].node;
+    list->tail = source[length - 1].node;
+}
+
+static void __linkedlist_radix_sort_chains(LinkedList *list, uint64_t (*key)(const void *element), unsigned key_bits) {
+    __Node *bucket_heads[256];
+    __Node *bucket_tails[256];
+    __Node *head = list->head;
+    uint64_t mask = __linkedlist_radix_key_mask(key_bits);
+    for (unsigned shift = 0; shift < key_bits; shift += 8) {
+        memset(bucket_heads, 0, sizeof(bucket_heads));
+        for (__Node *curr = head; curr != NULL; curr = curr->next) {
+            size_t digit = ((key(curr->element) & mask) >> shift) & 0xff;
+            if (bucket_heads[digit] == NULL) {
+                bucket_heads[digit] = curr;
+            } else {
+                bucket_tails[digit]->next = curr;
+            }
+            bucket_tails[digit] = curr;
+        }
+        // concatenate the buckets in order, only the next pointers are kept up to date between the passes
+        __Node *tail = NULL;
+        for (size_t digit = 0; digit < 256; digit++) {
+            if (bucket_heads[digit] == NULL) continue;
+            if (tail == NULL) {
+                head = bucket_heads[digit];
+            } else {
+                tail->next = bucket_heads[digit];
+            }
+            tail = bucket_tails[digit];
+        }
+        tail->next = NULL;
+    }
+
+    __Node *previous = NULL;
+    for (__Node *curr = head; curr != NULL; curr = curr->next) {
+        curr->previous = previous;
+        previous = curr;
+    }
+    list->head = head;
+    list->tail = previous;
+}
+
+void LinkedList_radix_sort(void *list_ptr, uint64_t (*key)(const void *element), unsigned key_bits) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(key != NULL);
+    assert((key_bits >= 1) && (key_bits <= 64));
+    LinkedList *list = *temp_list;
+    if (list->length < 2) return;
+    __linkedlist_detach(list);
+
+    // the keys are extracted once into a contiguous array sorted by counting, falling back to relinking the nodes into bucket chains every pass
+    __LinkedListRadixItem *items = malloc(2 * list->length * sizeof(__LinkedListRadixItem));
+    if (items != NULL) {
+        __linkedlist_radix_sort_items(list, items, key, key_bits);
+        free(items);
+    } else {
+        __linkedlist_radix_sort_chains(list, key, key_bits);
+    }
+    list->cached = NULL;
+}
+
+uint64_t LinkedList_radix_key_signed(int64_t value, unsigned key_bits) {
+    assert((key_bits >= 1) && (key_bits <= 64));
+    // flipping the sign bit moves the negative values below the positive ones
+    return ((uint64_t)value & __linkedlist_radix_key_mask(key_bits)) ^ ((uint64_t)1 << (key_bits - 1));
+}
+
+uint64_t LinkedList_radix_key_float(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    // negative values get all their bits flipped to reverse their order, positive ones only get the sign bit set
+    return (bits & UINT32_C(0x80000000)) ? (uint32_t)~bits : (bits | UINT32_C(0x80000000));
+}
+
+uint64_t LinkedList_radix_key_double(double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return (bits & UINT64_C(0x8000000000000000)) ? ~bits : (bits | UINT64_C(0x8000000000000000));
+}
+
+typedef struct __LinkedListExecutorJob {
+    size_t remaining; // the tasks of the job not done yet
+    pthread_mutex_t mutex;
+    pthread_cond_t done;
+} __LinkedListExecutorJob;
+
+typedef struct __LinkedListExecutorTask {
+    void *(*func)(void *);
+    void *argument;
+    __LinkedListExecutorJob *job;
+} __LinkedListExecutorTask;
+
+typedef struct __LinkedListWorker {
+    pthread_t thread;
+    pthread_mutex_t mutex; // guards the deque
+    __LinkedListExecutorTask *tasks; // the deque, a ring buffer
+    size_t capacity;
+    size_t top; // the index of the oldest task
+    size_t count;
+    LinkedListExecutorStats stats;
+    LinkedListExecutor *executor;
+    size_t index;
+} __LinkedListWorker;
+
+struct LinkedListExecutor {
+    __LinkedListWorker *workers;
+    size_t worker_count;
+    size_t cutoff;
+    size_t next_worker; // the worker the next task is given to
+    ptrdiff_t pending; // the tasks sitting in the deques, briefly negative when a task gets taken before its push is counted
+    LinkedListExecutorStats caller_stats; // the tasks run by the threads calling the parallel operations
+    bool shutdown;
+    pthread_mutex_t mutex; // guards the sleep of the workers
+    pthread_cond_t work_available;
+};
+
+static void __linkedlist_worker_push(__LinkedListWorker *worker, __LinkedListExecutorTask task) {
+    pthread_mutex_lock(&worker->mutex);
+    if (worker->count == worker->capacity) {
+        size_t capacity = (worker->capacity == 0) ? 16 : worker->capacity * 2;
+        __LinkedListExecutorTask *tasks = malloc(capacity * sizeof(__LinkedListExecutorTask));
+        assert(tasks != NULL);
+        for (size_t i = 0; i < worker->count; i++) {
+            tasks[i] = worker->tasks[(worker->top + i) % worker->capacity];
+        }
+        free(worker->tasks);
+        worker->tasks = tasks;
+        worker->capacity = capacity;
+        worker->top = 0;
+    }
+    worker->tasks[(worker->top + worker->count) % worker->capacity] = task;
+    worker->count++;
+    pthread_mutex_unlock(&worker->mutex);
+}
+
+// takes the newest task, for the owner of the deque
+static bool __linkedlist_worker_pop(__LinkedListWorker *worker, __LinkedListExecutorTask *task) {
+    pthread_mutex_lock(&worker->mutex);
+    bool found = worker->count > 0;
+    if (found) {
+        worker->count--;
+        *task = worker->tasks[(worker->top + worker->count) % worker->capacity];
+    }
+    pthread_mutex_unlock(&worker->mutex);
+    return found;
+}
+
+// takes the oldest task, for the other threads
+static bool __linkedlist_worker_steal(__LinkedListWorker *worker, __LinkedListExecutorTask *task) {
+    pthread_mutex_lock(&worker->mutex);
+    bool found = worker->count > 0;
+    if (found) {
+        *task = worker->tasks[worker->top];
+        worker->top = (worker->top + 1) % worker->capacity;
+        worker->count--;
+    }
+    pthread_mutex_unlock(&worker->mutex);
+    return found;
+}
+
+// takes a task from the deque of `self` (NULL for a calling thread), or steals one from the other deques, starting after `start`
+static bool __linkedlist_executor_take(LinkedListExecutor *executor, __LinkedListWorker *self, size_t start, __LinkedListExecutorTask *task) {
+    LinkedListExecutorStats *stats = (self != NULL) ? &self->stats : &executor->caller_stats;
+    bool found = (self != NULL) && __linkedlist_worker_pop(self, task);
+    for (size_t i = 1; !found && i <= executor->worker_count; i++) {
+        __LinkedListWorker *victim = &executor->workers[(start + i) % executor->worker_count];
+        if (victim != self && __linkedlist_worker_steal(victim, task)) {
+            found = true;
+            __atomic_fetch_add(&stats->steals, 1, __ATOMIC_RELAXED);
+        }
+    }
+    if (found) {
+        __atomic_fetch_sub(&executor->pending, 1, __ATOMIC_RELAXED);
+    }
+    return found;
+}
+
+static void __linkedlist_executor_execute(LinkedListExecutorStats *stats, __LinkedListExecutorTask task) {
+    task.func(task.argument);
+    __atomic_fetch_add(&stats->tasks_executed, 1, __ATOMIC_RELAXED);
+    pthread_mutex_lock(&task.job->mutex);
+    if (--task.job->remaining == 0) {
+        pthread_cond_broadcast(&task.job->done);
+    }
+    pthread_mutex_unlock(&task.job->mutex);
+}
+
+static void *__linkedlist_worker_main(void *worker_ptr) {
+    __LinkedListWorker *worker = worker_ptr;
+    LinkedListExecutor *executor = worker->executor;
+    while (true) {
+        __LinkedListExecutorTask task;
+        if (__linkedlist_executor_take(executor, worker, worker->index, &task)) {
+            __linkedlist_executor_execute(&worker->stats, task);
+            continue;
+        }
+        pthread_mutex_lock(&executor->mutex);
+        while (__atomic_load_n(&executor->pending, __ATOMIC_RELAXED) <= 0 && !executor->shutdown) {
+            pthread_cond_wait(&executor->work_available, &executor->mutex);
+        }
+        bool stop = executor->shutdown && __atomic_load_n(&executor->pending, __ATOMIC_RELAXED) <= 0;
+        pthread_mutex_unlock(&executor->mutex);
+        if (stop) return NULL;
+    }
+}
+
+LinkedListExecutor *LinkedList_executor_init(size_t worker_count, size_t cutoff) {
+    if (worker_count == 0) {
+        long processor_count = sysconf(_SC_NPROCESSORS_ONLN);
+        worker_count = (processor_count > 0) ? (size_t)processor_count : 1;
+    }
+    LinkedListExecutor *executor = malloc(sizeof(LinkedListExecutor));
+    assert(executor != NULL);
+    executor->workers = calloc(worker_count, sizeof(__LinkedListWorker));
+    assert(executor->workers != NULL);
+    executor->worker_count = worker_count;
+    executor->cutoff = (cutoff == 0) ? LINKEDLIST_EXECUTOR_DEFAULT_CUTOFF : cutoff;
+    executor->next_worker = 0;
+    executor->pending = 0;
+    executor->caller_stats = (LinkedListExecutorStats){ 0 };
+    executor->shutdown = false;
+    pthread_mutex_init(&executor->mutex, NULL);
+    pthread_cond_init(&executor->work_available, NULL);
+    for (size_t i = 0; i < worker_count; i++) {
+        executor->workers[i].executor = executor;
+        executor->workers[i].index = i;
+        pthread_mutex_init(&executor->workers[i].mutex, NULL);
+    }
+    for (size_t i = 0; i < worker_count; i++) {
+        int error = pthread_create(&executor->workers[i].thread, NULL, __linkedlist_worker_main, &executor->workers[i]);
+        assert(error == 0);
+        (void)error;
+    }
+    return executor;
+}
+
+void LinkedList_executor_destroy(LinkedListExecutor **executor_ptr) {
+    assert((executor_ptr != NULL) && (*executor_ptr != NULL));
+    LinkedListExecutor *executor = *executor_ptr;
+    pthread_mutex_lock(&executor->mutex);
+    executor->shutdown = true;
+    pthread_cond_broadcast(&executor->work_available);
+    pthread_mutex_unlock(&executor->mutex);
+    for (size_t i = 0; i < executor->worker_count; i++) {
+        pthread_join(executor->workers[i].thread, NULL);
+        pthread_mutex_destroy(&executor->workers[i].mutex);
+        free(executor->workers[i].tasks);
+    }
+    pthread_mutex_destroy(&executor->mutex);
+    pthread_cond_destroy(&executor->work_available);
+    free(executor->workers);
+    free(executor);
+    *executor_ptr = NULL;
+}
+
+size_t LinkedList_executor_worker_count(const LinkedListExecutor *executor) {
+    assert(executor != NULL);
+    return executor->worker_count;
+}
+
+LinkedListExecutorStats LinkedList_executor_stats(const LinkedListExecutor *executor, size_t worker) {
+    assert(executor != NULL);
+    assert(worker <= executor->worker_count);
+    const LinkedListExecutorStats *stats = (worker == executor->worker_count) ? &executor->caller_stats : &executor->workers[worker].stats;
+    return (LinkedListExecutorStats){
+        .tasks_executed = __atomic_load_n(&stats->tasks_executed, __ATOMIC_RELAXED),
+        .steals = __atomic_load_n(&stats->steals, __ATOMIC_RELAXED),
+    };
+}
+
+// the number of tasks to split `length` elements into, one per `cutoff` elements but no more than 4 per thread, enough for idle workers to steal some
+static size_t __linkedlist_executor_task_count(const LinkedListExecutor *executor, size_t length) {
+    if (executor == NULL) return 1;
+    size_t count = length / executor->cutoff;
+    size_t max_count = 4 * (executor->worker_count + 1);
+    if (count > max_count) count = max_count;
+    return (count == 0) ? 1 : count;
+}
+
+// runs func(arguments[i]) for every argument and waits for all of them, the first one on the calling thread, the rest on the workers
+static void __linkedlist_executor_run(LinkedListExecutor *executor, void *(*func)(void *), void **arguments, size_t count) {
+    if (executor == NULL || count < 2) {
+        for (size_t i = 0; i < count; i++) {
+            func(arguments[i]);
+        }
+        return;
+    }
+    __LinkedListExecutorJob job = { .remaining = count - 1 };
+    pthread_mutex_init(&job.mutex, NULL);
+    pthread_cond_init(&job.done, NULL);
+    size_t start = __atomic_fetch_add(&executor->next_worker, count - 1, __ATOMIC_RELAXED);
+    for (size_t i = 1; i < count; i++) {
+        __linkedlist_worker_push(&executor->workers[(start + i) % executor->worker_count], (__LinkedListExecutorTask){ func, arguments[i], &job });
+    }
+    // counted once every task is in a deque, so an idle worker woken by the count always finds one instead of spinning on empty deques
+    pthread_mutex_lock(&executor->mutex);
+    __atomic_fetch_add(&executor->pending, (ptrdiff_t)(count - 1), __ATOMIC_RELAXED);
+    pthread_cond_broadcast(&executor->work_available);
+    pthread_mutex_unlock(&executor->mutex);
+
+    func(arguments[0]);
+    __atomic_fetch_add(&executor->caller_stats.tasks_executed, 1, __ATOMIC_RELAXED);
+    // help with the remaining tasks instead of sleeping while there is work left
+    while (true) {
+        pthread_mutex_lock(&job.mutex);
+        bool done = job.remaining == 0;
+        pthread_mutex_unlock(&job.mutex);
+        if (done) break;
+        __LinkedListExecutorTask task;
+        if (!__linkedlist_executor_take(executor, NULL, start, &task)) break;
+        __linkedlist_executor_execute(&executor->caller_stats, task);
+    }
+    pthread_mutex_lock(&job.mutex);
+    while (job.remaining > 0) {
+        pthread_cond_wait(&job.done, &job.mutex);
+    }
+    pthread_mutex_unlock(&job.mutex);
+    pthread_mutex_destroy(&job.mutex);
+    pthread_cond_destroy(&job.done);
+}
+
+typedef struct __LinkedListSortSegment {
+    LinkedList list; // the segment, as a list of its own
+    struct __LinkedListSortSegment *merge_with; // the segment following this one, merged into it
+    int (*ordering_comparator)(const void *, const void *);
+} __LinkedListSortSegment;
+
+static void *__linkedlist_sort_segment(void *segment_ptr) {
+    __LinkedListSortSegment *segment = segment_ptr;
+    LinkedList *list = &segment->list;
+    __LinkedList_sort__(&list, segment->ordering_comparator, void, __LinkedList_compare_erased__);
+    return NULL;
+}
+
+static void *__linkedlist_merge_segments(void *segment_ptr) {
+    __LinkedListSortSegment *segment = segment_ptr;
+    __LinkedListSortSegment *other = segment->merge_with;
+    __Node *head, *tail;
+    __LinkedList_merge__(segment->list.head, segment->list.tail, other->list.head, other->list.tail, &head, &tail, segment->ordering_comparator, void, __LinkedList_compare_erased__);
+    segment->list.head = head;
+    segment->list.tail = tail;
+    segment->list.length += other->list.length;
+    return NULL;
+}
+
+void LinkedList_sort_parallel(void *list_ptr, int (*ordering_comparator)(const void *, const void *), LinkedListExecutor *executor) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(ordering_comparator != NULL);
+    LinkedList *list = *temp_list;
+    __linkedlist_detach(list);
+
+    size_t segment_count = __linkedlist_executor_task_count(executor, list->length);
+    __LinkedListSortSegment *segments = NULL;
+    void **arguments = NULL;
+    if (segment_count > 1) {
+        segments = malloc(segment_count * sizeof(__LinkedListSortSegment));
+        arguments = malloc(segment_count * sizeof(void *));
+    }
+    if (segments == NULL || arguments == NULL) {
+        free(segments);
+        free(arguments);
+        __LinkedList_sort__(temp_list, ordering_comparator, void, __LinkedList_compare_erased__);
+        return;
+    }
+
+    // cut the list into segments of (almost) equal lengths
+    __Node *curr = list->head;
+    for (size_t i = 0; i < segment_count; i++) {
+        size_t length = list->length / segment_count + (i < list->length % segment_count);
+        __LinkedListSortSegment *segment = &segments[i];
+        segment->list = (LinkedList){ .head = curr, .length = length, .element_size = list->element_size };
+        segment->ordering_comparator = ordering_comparator;
+        for (size_t j = 1; j < length; j++) {
+            curr = curr->next;
+        }
+        segment->list.tail = curr;
+        curr = curr->next;
+        segment->list.tail->next = NULL;
+        if (curr != NULL) {
+            curr->previous = NULL;
+        }
+        arguments[i] = segment;
+    }
+    __linkedlist_executor_run(executor, __linkedlist_sort_segment, arguments, segment_count);
+
+    // merge the segments pairwise, each round halving their count
+    for (size_t step = 1; step < segment_count; step *= 2) {
+        size_t merge_count = 0;
+        for (size_t i = 0; i + step < segment_count; i += 2 * step) {
+            segments[i].merge_with = &segments[i + step];
+            arguments[merge_count++] = &segments[i];
+        }
+        __linkedlist_executor_run(executor, __linkedlist_merge_segments, arguments, merge_count);
+    }
+
+    list->head = segments[0].list.head;
+    list->tail = segments[0].list.tail;
+    list->cached = NULL;
+    free(segments);
+    free(arguments);
+}
+
+typedef struct __LinkedListSegmentTask {
+    __Node *head;
+    size_t length;
+    void (*func)(void *element, void *context);
+    void (*mapper)(const void *element, void *result);
+    void (*reducer)(void *accumulator, const void *element);
+    void *context; // the context of func, or the accumulator of reducer
+    size_t result_size;
+    __Node *result_head; // the chain built by mapper
+    __Node *result_tail;
+} __LinkedListSegmentTask;
+
+typedef struct __LinkedListParallelJob {
+    __LinkedListSegmentTask *tasks;
+    void **arguments;
+    size_t count;
+} __LinkedListParallelJob;
+
+// cuts the list into segments of (almost) equal lengths with one walk, without touching the links,
+// every task is a copy of the template covering one segment, false if the job can't be allocated
+static bool __linkedlist_job_init(__LinkedListParallelJob *job, LinkedList *list, const __LinkedListSegmentTask *template, LinkedListExecutor *executor) {
+    job->count = __linkedlist_executor_task_count(executor, list->length);
+    job->tasks = malloc(job->count * sizeof(__LinkedListSegmentTask));
+    job->arguments = malloc(job->count * sizeof(void *));
+    if (job->tasks == NULL || job->arguments == NULL) {
+        free(job->tasks);
+        free(job->arguments);
+        return false;
+    }
+    __Node *curr = list->head;
+    for (size_t i = 0; i < job->count; i++) {
+        job->tasks[i] = *template;
+        job->tasks[i].head = curr;
+        job->tasks[i].length = list->length / job->count + (i < list->length % job->count);
+        for (size_t j = 0; j < job->tasks[i].length; j++) {
+            curr = curr->next;
+        }
+        job->arguments[i] = &job->tasks[i];
+    }
+    return true;
+}
+
+static void __linkedlist_job_destroy(__LinkedListParallelJob *job) {
+    free(job->tasks);
+    free(job->arguments);
+}
+
+static void *__linkedlist_foreach_segment(void *task_ptr) {
+    __LinkedListSegmentTask *task = task_ptr;
+    __Node *curr = task->head;
+    for (size_t i = 0; i < task->length; i++, curr = curr->next) {
+        task->func(curr->element, task->context);
+    }
+    return NULL;
+}
+
+static void *__linkedlist_map_segment(void *task_ptr) {
+    __LinkedListSegmentTask *task = task_ptr;
+    __Node *curr = task->head;
+    for (size_t i = 0; i < task->length; i++, curr = curr->next) {
+        __Node *node = __node_init(task->result_size);
+        task->mapper(curr->element, node->element);
+        node->previous = task->result_tail;
+        if (task->result_tail == NULL) {
+            task->result_head = node;
+        } else {
+            task->result_tail->next = node;
+        }
+        task->result_tail = node;
+    }
+    return NULL;
+}
+
+static void *__linkedlist_reduce_segment(void *task_ptr) {
+    __LinkedListSegmentTask *task = task_ptr;
+    __Node *curr = task->head;
+    for (size_t i = 0; i < task->length; i++, curr = curr->next) {
+        task->reducer(task->context, curr->element);
+    }
+    return NULL;
+}
+
+void LinkedList_par_foreach(void *list_ptr, void (*func)(void *element, void *context), void *context, LinkedListExecutor *executor) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(func != NULL);
+    LinkedList *list = *temp_list;
+    __linkedlist_detach(list);
+    __LinkedListSegmentTask template = { .head = list->head, .length = list->length, .func = func, .context = context };
+    __LinkedListParallelJob job;
+    if (!__linkedlist_job_init(&job, list, &template, executor)) {
+        __linkedlist_foreach_segment(&template);
+        return;
+    }
+    __linkedlist_executor_run(executor, __linkedlist_foreach_segment, job.arguments, job.count);
+    __linkedlist_job_destroy(&job);
+}
+
+void *LinkedList_par_map(void *list_ptr, void (*mapper)(const void *element, void *result), size_t result_size, LinkedListExecutor *executor) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert(mapper != NULL);
+    LinkedList *list = *temp_list;
+    LinkedList *new_list = __linkedlist_init(result_size);
+    __LinkedListSegmentTask template = { .head = list->head, .length = list->length, .mapper = mapper, .result_size = result_size };
+    __LinkedListParallelJob job;
+    if (!__linkedlist_job_init(&job, list, &template, executor)) {
+        __linkedlist_map_segment(&template);
+        new_list->head = template.result_head;
+        new_list->tail = template.result_tail;
+        new_list->length = list->length;
+        return new_list;
+    }
+    __linkedlist_executor_run(executor, __linkedlist_map_segment, job.arguments, job.count);
+    // link the chains of the segments together
+    for (size_t i = 0; i < job.count; i++) {
+        __LinkedListSegmentTask *task = &job.tasks[i];
+        if (task->result_head == NULL) continue;
+        if (new_list->tail == NULL) {
+            new_list->head = task->result_head;
+        } else {
+            new_list->tail->next = task->result_head;
+            task->result_head->previous = new_list->tail;
+        }
+        new_list->tail = task->result_tail;
+    }
+    new_list->length = list->length;
+    __linkedlist_job_destroy(&job);
+    return new_list;
+}
+
+void LinkedList_par_reduce(void *list_ptr, void (*reducer)(void *accumulator, const void *element), void (*combiner)(void *accumulator, const void *other_accumulator), void *accumulator, size_t accumulator_size, LinkedListExecutor *executor) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    assert((reducer != NULL) && (combiner != NULL) && (accumulator != NULL));
+    LinkedList *list = *temp_list;
+    __LinkedListSegmentTask template = { .head = list->head, .length = list->length, .reducer = reducer, .context = accumulator };
+    __LinkedListParallelJob job;
+    char *accumulators = NULL;
+    if (__linkedlist_job_init(&job, list, &template, executor)) {
+        accumulators = malloc(job.count * accumulator_size);
+        if (accumulators == NULL) {
+            __linkedlist_job_destroy(&job);
+        }
+    }
+    if (accumulators == NULL) {
+        __linkedlist_reduce_segment(&template);
+        return;
+    }
+    // the first segment reduces straight into the caller's accumulator
+    for (size_t i = 1; i < job.count; i++) {
+        job.tasks[i].context = accumulators + i * accumulator_size;
+        memcpy(job.tasks[i].context, accumulator, accumulator_size);
+    }
+    __linkedlist_executor_run(executor, __linkedlist_reduce_segment, job.arguments, job.count);
+    for (size_t i = 1; i < job.count; i++) {
+        combiner(accumulator, job.tasks[i].context);
+    }
+    free(accumulators);
+    __linkedlist_job_destroy(&job);
+}
+
+void __node_free_chain(__Node *node) {
+    while (node != NULL) {
+        __Node *next_node = node->next;
+        free(node);
+        node = next_node;
+    }
+}
+
+LinkedListView LinkedList_view(void *list_ptr) {
+    LinkedList **temp_list = list_ptr;
+    assert((temp_list != NULL) && (*temp_list != NULL));
+    LinkedListView view;
+    view.list = *temp_list;
+    view.first = NULL;
+    view.source_length = 0;
+    view.step = 1;
+    view.stage_count = 0;
+    view.element_size = (*temp_list)->element_size;
+    return view;
+}
+
+LinkedListView LinkedList_slice_view(void *list_ptr, ptrdiff_t start, ptrdiff_t end, ptrdiff_t step) {
+    LinkedListView view = LinkedList_view(list_ptr);
+    ptrdiff_t length = (ptrdiff_t)view.list->length;
+    assert(step != 0);
+    if (step > 0) {
+        assert(0 <= start && start <= end && end <= length);
+        view.source_length = (size_t)((end - start + step - 1) / step);
+    } else {
+        assert(-1 <= end && end <= start && start < length);
+        view.source_length = (size_t)((start - end - step - 1) / -step);
+    }
+    view.step = step;
+    if (view.source_length > 0) {
+        view.first = __linkedlist_node_at(list_ptr, (size_t)start);
+    } else {
+        view.list = NULL; // an empty slice produces nothing
+    }
+    return view;
+}
+
+static __LinkedListViewStage *__linkedlist_view_add_stage(LinkedListView *view, __LinkedListViewStageKind kind) {
+    assert(view != NULL);
+    assert(view->stage_count < LINKEDLIST_VIEW_MAX_STAGES);
+    __LinkedListViewStage *stage = &view->stages[view->stage_count++];
+    stage->kind = kind;
+    stage->filter = NULL;
+    stage->mapper = NULL;
+    stage->count = 0;
+    stage->result_size = 0;
+    return stage;
+}
+
+LinkedListView *LinkedList_view_filter(LinkedListView *view, bool (*filter)(const void *element)) {
+    assert(filter != NULL);
+    __linkedlist_view_add_stage(view, __LINKEDLIST_VIEW_FILTER)->filter = filter;
+    return view;
+}
+
+LinkedListView *LinkedList_view_map(LinkedListView *view, void (*mapper)(const void *element, void *result), size_t result_size) {
+    assert(mapper != NULL);
+    assert(result_size > 0);
+    __LinkedListViewStage *stage = __linkedlist_view_add_stage(view, __LINKEDLIST_VIEW_MAP);
+    stage->mapper = mapper;
+    stage->result_size = result_size;
+    view->element_size = result_size;
+    return view;
+}
+
+LinkedListView *LinkedList_view_take(LinkedListView *view, size_t count) {
+    __linkedlist_view_add_stage(view, __LINKEDLIST_VIEW_TAKE)->count = count;
+    return view;
+}
+
+LinkedListView *LinkedList_view_skip(LinkedListView *view, size_t count) {
+    __linkedlist_view_add_stage(view, __LINKEDLIST_VIEW_SKIP)->count = count;
+    return view;
+}
+
+/**
+ * Runs every stage of the view on each element in a single traversal and hands the surviving elements to the sink.
+ * Mapped values live in two scratch buffers that map stages alternate between, they are the only allocation.
+ */
+static void __linkedlist_view_run(const LinkedListView *view, void (*sink)(const void *element, void *context), void *context) {
+    assert(view != NULL);
+    size_t counters[LINKEDLIST_VIEW_MAX_STAGES] = {0};
+    size_t buffer_size = 0;
+    for (size_t i = 0; i < view->stage_count; i++) {
+        if (view->stages[i].kind == __LINKEDLIST_VIEW_MAP && view->stages[i].result_size > buffer_size) {
+            buffer_size = view->stages[i].result_size;
+        }
+    }
+    // the second buffer starts at buffer_size, rounded up so that it is aligned for any mapped type
+    buffer_size = (buffer_size + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t);
+    char *buffers = NULL;
+    if (buffer_size > 0) {
+        buffers = malloc(2 * buffer_size);
+        assert(buffers != NULL);
+    }
+
+    bool exhausted = false;
+    __Node *node = (view->first != NULL) ? view->first : (view->list != NULL ? view->list->head : NULL);
+    size_t remaining = (view->first != NULL) ? view->source_length : (view->list != NULL ? view->list->length : 0);
+    for ( ; remaining > 0 && !exhausted; remaining--) {
+        const void *current = node->element;
+        size_t map_count = 0;
+        bool dropped = false;
+        for (size_t i = 0; i < view->stage_count && !dropped; i++) {
+            const __LinkedListViewStage *stage = &view->stages[i];
+            switch (stage->kind) {
+                case __LINKEDLIST_VIEW_FILTER:
+                    dropped = !stage->filter(current);
+                    break;
+                case __LINKEDLIST_VIEW_MAP: {
+                    void *result = buffers + (map_count++ % 2) * buffer_size;
+                    stage->mapper(current, result);
+                    current = result;
+                    break;
+                }
+                case __LINKEDLIST_VIEW_SKIP:
+                    if (counters[i] < stage->count) {
+                        counters[i]++;
+                        dropped = true;
+                    }
+                    break;
+                case __LINKEDLIST_VIEW_TAKE:
+                    // no element can get past an exhausted take, so the traversal stops right there
+                    if (counters[i] == stage->count) {
+                        exhausted = true;
+                        dropped = true;
+                    } else {
+                        counters[i]++;
+                    }
+                    break;
+            }
+        }
+        if (!dropped) {
+            sink(current, context);
+        }
+        // walk to the next node of the source, never past the last one
+        for (ptrdiff_t i = 0; remaining > 1 && i < view->step; i++) {
+            node = node->next;
+        }
+        for (ptrdiff_t i = 0; remaining > 1 && i > view->step; i--) {
+            node = node->previous;
+        }
+    }
+    free(buffers);
+}
+
+static void __linkedlist_view_count_sink(const void *element, void *context) {
+    (void)element;
+    (*(size_t *)context)++;
+}
+
+size_t LinkedList_view_count(const LinkedListView *view) {
+    size_t count = 0;
+    __linkedlist_view_run(view, __linkedlist_view_count_sink, &count);
+    return count;
+}
+
+void LinkedList_view_foreach(const LinkedListView *view, void (*func)(const void *element, void *context), void *context) {
+    assert(func != NULL);
+    __linkedlist_view_run(view, func, context);
+}
+
+typedef struct __LinkedListViewReduceContext {
+    void (*reducer)(void *accumulator, const void *element);
+    void *accumulator;
+} __LinkedListViewReduceContext;
+
+static void __linkedlist_view_reduce_sink(const void *element, void *context) {
+    __LinkedListViewReduceContext *reduce_context = context;
+    reduce_context->reducer(reduce_context->accumulator, element);
+}
+
+void LinkedList_view_reduce(const LinkedListView *view, void (*reducer)(void *accumulator, const void *element), void *accumulator) {
+    assert(reducer != NULL);
+    assert(accumulator != NULL);
+    __LinkedListViewReduceContext context = { reducer, accumulator };
+    __linkedlist_view_run(view, __linkedlist_view_reduce_sink, &context);
+}
+
+static void __linkedlist_view_collect_sink(const void *element, void *context) {
+    LinkedList *list = context;
+    __Node *node = __node_init(list->element_size);
+    memcpy(node->element, element, list->element_size);
+    node->previous = list->tail;
+    if (list->head == NULL) {
+        list->head = node;
+    } else {
+        list->tail->next = node;
+    }
+    list->tail = node;
+    list->length++;
+}
+
+void *LinkedList_view_collect(const LinkedListView *view) {
+    assert(view != NULL);
+    LinkedList *list = __linkedlist_init(view->element_size);
+    __linkedlist_view_run(view, __linkedlist_view_collect_sink, list);
+    return list;
+}
+
+typedef struct __LinkedListViewArrayContext {
+    char *array;
+    size_t element_size;
+    size_t count;
+} __LinkedListViewArrayContext;
+
+static void __linkedlist_view_array_sink(const void *element, void *context) {
+    __LinkedListViewArrayContext *array_context = context;
+    memcpy(array_context->array + array_context->count * array_context->element_size, element, array_context->element_size);
+    array_context->count++;
+}
+
+size_t LinkedList_view_to_array(const LinkedListView *view, void *array) {
+    assert(view != NULL);
+    assert(array != NULL);
+    __LinkedListViewArrayContext context = { array, view->element_size, 0 };
+    __linkedlist_view_run(view, __linkedlist_view_array_sink, &context);
+    return context.count;
+}
+
+typedef struct __LinkedListConcurrentNode {
+    pthread_rwlock_t lock;
+    struct __LinkedListConcurrentNode *next;
+    struct __LinkedListConcurrentNode *previous;
+    char element[];
+} __LinkedListConcurrentNode;
+
+// Nodes get locked in list order (hand-over-hand from the head sentinel), the operations on the back lock the tail sentinel first
+// and only try the locks before it, backing off when one is taken, so no two threads ever wait on each other.
+struct LinkedListConcurrent {
+    __LinkedListConcurrentNode *head; // sentinel
+    __LinkedListConcurrentNode *tail; // sentinel
+    size_t element_size;
+    size_t length; // atomic
+};
+
+static __LinkedListConcurrentNode *__linkedlist_concurrent_node_init(size_t element_size, const void *element) {
+    __LinkedListConcurrentNode *node = malloc(sizeof(__LinkedListConcurrentNode) + element_size);
+    assert(node != NULL);
+    pthread_rwlock_init(&node->lock, NULL);
+    node->next = NULL;
+    node->previous = NULL;
+    if (element != NULL) {
+        memcpy(node->element, element, element_size);
+    }
+    return node;
+}
+
+static void __linkedlist_concurrent_node_free(__LinkedListConcurrentNode *node) {
+    pthread_rwlock_destroy(&node->lock);
+    free(node);
+}
+
+static void __linkedlist_concurrent_lock(__LinkedListConcurrentNode *node, bool write) {
+    if (write) {
+        pthread_rwlock_wrlock(&node->lock);
+    } else {
+        pthread_rwlock_rdlock(&node->lock);
+    }
+}
+
+static void __linkedlist_concurrent_unlock(__LinkedListConcurrentNode *node) {
+    pthread_rwlock_unlock(&node->lock);
+}
+
+// Walks hand-over-hand to the node before the index (the head sentinel for 0) and returns it locked, or NULL when the list is shorter than the index.
+static __LinkedListConcurrentNode *__linkedlist_concurrent_lock_predecessor(LinkedListConcurrent *list, size_t index, bool write) {
+    __LinkedListConcurrentNode *node = list->head;
+    __linkedlist_concurrent_lock(node, write);
+    for (size_t i = 0; i < index; i++) {
+        __LinkedListConcurrentNode *next_node = node->next;
+        if (next_node == list->tail) {
+            __linkedlist_concurrent_unlock(node);
+            return NULL;
+        }
+        __linkedlist_concurrent_lock(next_node, write);
+        __linkedlist_concurrent_unlock(node);
+        node = next_node;
+    }
+    return node;
+}
+
+// Unlinks the node, its neighbours and itself being write locked, the caller unlocks and frees it.
+static void __linkedlist_concurrent_unlink(LinkedListConcurrent *list, __LinkedListConcurrentNode *node) {
+    node->previous->next = node->next;
+    node->next->previous = node->previous;
+    __atomic_fetch_sub(&list->length, 1, __ATOMIC_RELAXED);
+}
+
+LinkedListConcurrent *__linkedlist_init_concurrent(size_t element_size) {
+    LinkedListConcurrent *list = malloc(sizeof(LinkedListConcurrent));
+    assert(list != NULL);
+    list->head = __linkedlist_concurrent_node_init(0, NULL);
+    list->tail = __linkedlist_concurrent_node_init(0, NULL);
+    list->head->next = list->tail;
+    list->tail->previous = list->head;
+    list->element_size = element_size;
+    list->length = 0;
+    return list;
+}
+
+void LinkedList_concurrent_destroy(LinkedListConcurrent **list_ptr) {
+    assert((list_ptr != NULL) && (*list_ptr != NULL));
+    __LinkedListConcurrentNode *node = (*list_ptr)->head;
+    while (node != NULL) {
+        __LinkedListConcurrentNode *next_node = node->next;
+        __linkedlist_concurrent_node_free(node);
+        node = next_node;
+    }
+    free(*list_ptr);
+    *list_ptr = NULL;
+}
+
+size_t LinkedList_concurrent_length(const LinkedListConcurrent *list) {
+    assert(list != NULL);
+    return __atomic_load_n(&list->length, __ATOMIC_RELAXED);
+}
+
+bool LinkedList_concurrent_insert_at(LinkedListConcurrent *list, size_t index, const void *element) {
+    assert(list != NULL);
+    assert(element != NULL);
+    __LinkedListConcurrentNode *node = __linkedlist_concurrent_node_init(list->element_size, element);
+    __LinkedListConcurrentNode *previous_node = __linkedlist_concurrent_lock_predecessor(list, index, true);
+    if (previous_node == NULL) {
+        __linkedlist_concurrent_node_free(node);
+        return false;
+    }
+    __LinkedListConcurrentNode *next_node = previous_node->next;
+    __linkedlist_concurrent_lock(next_node, true);
+    node->previous = previous_node;
+    node->next = next_node;
+    previous_node->next = node;
+    next_node->previous = node;
+    __atomic_fetch_add(&list->length, 1, __ATOMIC_RELAXED);
+    __linkedlist_concurrent_unlock(next_node);
+    __linkedlist_concurrent_unlock(previous_node);
+    return true;
+}
+
+void LinkedList_concurrent_push_front(LinkedListConcurrent *list, const void *element) {
+    // index 0 is never out of bounds
+    LinkedList_concurrent_insert_at(list, 0, element);
+}
+
+void LinkedList_concurrent_push(LinkedListConcurrent *list, const void *element) {
+    assert(list != NULL);
+    assert(element != NULL);
+    __LinkedListConcurrentNode *node = __linkedlist_concurrent_node_init(list->element_size, element);
+    for (;;) {
+        __linkedlist_concurrent_lock(list->tail, true);
+        // tail->previous can't change while the tail is locked
+        __LinkedListConcurrentNode *previous_node = list->tail->previous;
+        if (pthread_rwlock_trywrlock(&previous_node->lock) == 0) {
+            node->previous = previous_node;
+            node->next = list->tail;
+            previous_node->next = node;
+            list->tail->previous = node;
+            __atomic_fetch_add(&list->length, 1, __ATOMIC_RELAXED);
+            __linkedlist_concurrent_unlock(previous_node);
+            __linkedlist_concurrent_unlock(list->tail);
+            return;
+        }
+        __linkedlist_concurrent_unlock(list->tail);
+        sched_yield();
+    }
+}
+
+bool LinkedList_concurrent_get(LinkedListConcurrent *list, size_t index, void *element) {
+    assert(list != NULL);
+    assert(element != NULL);
+    __LinkedListConcurrentNode *node = __linkedlist_concurrent_lock_predecessor(list, index + 1, false);
+    if (node == NULL) return false;
+    memcpy(element, node->element, list->element_size);
+    __linkedlist_concurrent_unlock(node);
+    return true;
+}
+
+bool LinkedList_concurrent_set(LinkedListConcurrent *list, size_t index, const void *element) {
+    assert(list != NULL);
+    assert(element != NULL);
+    __LinkedListConcurrentNode *node = __linkedlist_concurrent_lock_predecessor(list, index + 1, true);
+    if (node == NULL) return false;
+    memcpy(node->element, element, list->element_size);
+    __linkedlist_concurrent_unlock(node);
+    return true;
+}
+
+bool LinkedList_concurrent_remove_at(LinkedListConcurrent *list, size_t index, void *element) {
+    assert(list != NULL);
+    __LinkedListConcurrentNode *previous_node = __linkedlist_concurrent_lock_predecessor(list, index, true);
+    if (previous_node == NULL) return false;
+    __LinkedListConcurrentNode *node = previous_node->next;
+    if (node == list->tail) {
+        __linkedlist_concurrent_unlock(previous_node);
+        return false;
+    }
+    __linkedlist_concurrent_lock(node, true);
+    __linkedlist_concurrent_lock(node->next, true);
+    __LinkedListConcurrentNode *next_node = node->next;
+    __linkedlist_concurrent_unlink(list, node);
+    __linkedlist_concurrent_unlock(next_node);
+    __linkedlist_concurrent_unlock(previous_node);
+    // every other thread reaches the node through the locked previous node, so nobody is waiting on it anymore
+    __linkedlist_concurrent_unlock(node);
+    if (element != NULL) {
+        memcpy(element, node->element, list->element_size);
+    }
+    __linkedlist_concurrent_node_free(node);
+    return true;
+}
+
+bool LinkedList_concurrent_pop_front(LinkedListConcurrent *list, void *element) {
+    return LinkedList_concurrent_remove_at(list, 0, element);
+}
+
+bool LinkedList_concurrent_pop(LinkedListConcurrent *list, void *element) {
+    assert(list != NULL);
+    for (;;) {
+        __linkedlist_concurrent_lock(list->tail, true);
+        __LinkedListConcurrentNode *node = list->tail->previous;
+        if (node == list->head) {
+            __linkedlist_concurrent_unlock(list->tail);
+            return false;
+        }
+        if (pthread_rwlock_trywrlock(&node->lock) == 0) {
+            // node->previous can't change while the node is locked
+            __LinkedListConcurrentNode *previous_node = node->previous;
+            if (pthread_rwlock_trywrlock(&previous_node->lock) == 0) {
+                __linkedlist_concurrent_unlink(list, node);
+                __linkedlist_concurrent_unlock(previous_node);
+                __linkedlist_concurrent_unlock(list->tail);
+                __linkedlist_concurrent_unlock(node);
+                if (element != NULL) {
+                    memcpy(element, node->element, list->element_size);
+                }
+                __linkedlist_concurrent_node_free(node);
+                return true;
+            }
+            __linkedlist_concurrent_unlock(node);
+        }
+        __linkedlist_concurrent_unlock(list->tail);
+        sched_yield();
+    }
+}
+
+size_t LinkedList_concurrent_find(LinkedListConcurrent *list, const void *value, bool (*boolean_comparator)(const void *element, const void *value)) {
+    assert(list != NULL);
+    assert(boolean_comparator != NULL);
+    __LinkedListConcurrentNode *node = list->head;
+    __linkedlist_concurrent_lock(node, false);
+    for (size_t index = 0; node->next != list->tail; index++) {
+        __LinkedListConcurrentNode *next_node = node->next;
+        __linkedlist_concurrent_lock(next_node, false);
+        __linkedlist_concurrent_unlock(node);
+        node = next_node;
+        if (boolean_comparator(node->element, value)) {
+            __linkedlist_concurrent_unlock(node);
+            return index;
+        }
+    }
+    __linkedlist_concurrent_unlock(node);
+    return LINKEDLIST_NOT_FOUND;
+}
+
+size_t LinkedList_concurrent_remove_value(LinkedListConcurrent *list, const void *value, bool (*boolean_comparator)(const void *element, const void *value)) {
+    assert(list != NULL);
+    assert(boolean_comparator != NULL);
+    __LinkedListConcurrentNode *previous_node = list->head;
+    __linkedlist_concurrent_lock(previous_node, true);
+    for (size_t index = 0; previous_node->next != list->tail; index++) {
+        __LinkedListConcurrentNode *node = previous_node->next;
+        __linkedlist_concurrent_lock(node, true);
+        if (boolean_comparator(node->element, value)) {
+            __LinkedListConcurrentNode *next_node = node->next;
+            __linkedlist_concurrent_lock(next_node, true);
+            __linkedlist_concurrent_unlink(list, node);
+            __linkedlist_concurrent_unlock(next_node);
+            __linkedlist_concurrent_unlock(previous_node);
+            __linkedlist_concurrent_unlock(node);
+            __linkedlist_concurrent_node_free(node);
+            return index;
+        }
+        __linkedlist_concurrent_unlock(previous_node);
+        previous_node = node;
+    }
+    __linkedlist_concurrent_unlock(previous_node);
+    return LINKEDLIST_NOT_FOUND;
+}
+
+void LinkedList_concurrent_foreach(LinkedListConcurrent *list, void (*func)(const void *element, void *context), void *context) {
+    assert(list != NULL);
+    assert(func != NULL);
+    __LinkedListConcurrentNode *node = list->head;
+    __linkedlist_concurrent_lock(node, false);
+    while (node->next != list->tail) {
+        __LinkedListConcurrentNode *next_node = node->next;
+        __linkedlist_concurrent_lock(next_node, false);
+        __linkedlist_concurrent_unlock(node);
+        node = next_node;
+        func(node->element, context);
+    }
+    __linkedlist_concurrent_unlock(node);
+}
+
+// Vyukov's queue: the producers exchange the tail then link the previous tail to their node, the consumer owns a dummy node
+// whose next node holds the first element, and that node becomes the dummy once its element is copied out.
+struct LinkedListMPSC {
+    __Node *head; // the dummy node, consumer only
+    char padding[64 - sizeof(__Node *)]; // keeps the consumer's and the producers' ends on different cache lines
+    __Node *tail; // exchanged by the producers
+    size_t element_size;
+};
+
+LinkedListMPSC *__linkedlist_init_mpsc(size_t element_size) {
+    LinkedListMPSC *queue = malloc(sizeof(LinkedListMPSC));
+    assert(queue != NULL);
+    queue->head = __node_init(element_size);
+    queue->tail = queue->head;
+    queue->element_size = element_size;
+    return queue;
+}
+
+void LinkedList_mpsc_destroy(LinkedListMPSC **queue_ptr) {
+    assert((queue_ptr != NULL) && (*queue_ptr != NULL));
+    __node_free_chain((*queue_ptr)->head);
+    free(*queue_ptr);
+    *queue_ptr = NULL;
+}
+
+void LinkedList_mpsc_push(LinkedListMPSC *queue, const void *element) {
+    assert(queue != NULL);
+    assert(element != NULL);
+    __Node *node = __node_init(queue->element_size);
+    memcpy(node->element, element, queue->element_size);
+    __Node *previous_node = __atomic_exchange_n(&queue->tail, node, __ATOMIC_ACQ_REL);
+    // until this store the consumer sees the queue ending at previous_node
+    __atomic_store_n(&previous_node->next, node, __ATOMIC_RELEASE);
+}
+
+bool LinkedList_mpsc_pop(LinkedListMPSC *queue, void *element) {
+    assert(queue != NULL);
+    __Node *dummy = queue->head;
+    __Node *node = __atomic_load_n(&dummy->next, __ATOMIC_ACQUIRE);
+    if (node == NULL) return false;
+    if (element != NULL) {
+        memcpy(element, node->element, queue->element_size);
+    }
+    queue->head = node;
+    free(dummy);
+    return true;
+}
+
+size_t LinkedList_mpsc_pop_batch(LinkedListMPSC *queue, size_t count, void *elements) {
+    assert(queue != NULL);
+    __Node *dummy = queue->head;
+    size_t popped = 0;
+    while (popped < count) {
+        __Node *node = __atomic_load_n(&dummy->next, __ATOMIC_ACQUIRE);
+        if (node == NULL) break;
+        if (elements != NULL) {
+            memcpy((char *)elements + popped * queue->element_size, node->element, queue->element_size);
+        }
+        free(dummy);
+        dummy = node;
+        popped++;
+    }
+    queue->head = dummy;
+    return popped;
+}
+
+// Harris-Michael list: a node is deleted logically by marking the lowest bit of its next link, which makes every CAS on that link fail,
+// then physically by swinging the previous link past it, either by the remover or by any traversal that meets it.
+typedef struct __LinkedListLockFreeNode {
+    uintptr_t next; // the next node, the lowest bit marks this node as deleted
+    struct __LinkedListLockFreeNode *retired_next;
+    char element[];
+} __LinkedListLockFreeNode;
+
+#define __LINKEDLIST_LOCKFREE_MARK ((uintptr_t)1)
+#define __LINKEDLIST_LOCKFREE_RETIRE_THRESHOLD 64
+
+// Epoch based reclamation: a thread publishes the global epoch it runs in while it is inside an operation, and the global epoch only moves
+// from e to e + 1 once every thread inside an operation runs in e. A node unlinked when the global epoch was e can only be held by threads
+// that entered in e or before, so it is freed once the global epoch reaches e + 2.
+typedef struct __LinkedListEpochRecord {
+    size_t state; // (epoch << 1) | 1 while inside an operation, 0 outside
+    size_t epoch; // the epoch of the last operation, owner only
+    pthread_t owner; // set before the record is published, never changed
+    __LinkedListLockFreeNode *retired[3]; // by epoch modulo 3, owner only
+    size_t retired_epoch[3]; // the latest epoch of each retired list
+    size_t retired_count;
+    struct __LinkedListEpochRecord *next;
+} __LinkedListEpochRecord;
+
+struct LinkedListLockFree {
+    uintptr_t head;
+    size_t element_size;
+    int (*ordering_comparator)(const void *, const void *);
+    size_t length; // atomic
+    size_t epoch; // atomic
+    __LinkedListEpochRecord *records; // prepended with CAS, never removed before destroy
+};
+
+static void __linkedlist_free_retired(__LinkedListLockFreeNode *node) {
+    while (node != NULL) {
+        __LinkedListLockFreeNode *next_node = node->retired_next;
+        free(node);
+        node = next_node;
+    }
+}
+
+static __LinkedListEpochRecord *__linkedlist_epoch_record(LinkedListLockFree *list) {
+    // records are keyed on the thread id: a thread that exited is outside any operation, so a new thread that gets its id takes its
+    // record over (with the nodes it retired), and the records stay bounded by the number of threads alive at once
+    pthread_t self = pthread_self();
+    __LinkedListEpochRecord *record;
+    for (record = __atomic_load_n(&list->records, __ATOMIC_ACQUIRE); record != NULL; record = record->next) {
+        if (pthread_equal(record->owner, self)) return record;
+    }
+    record = calloc(1, sizeof(__LinkedListEpochRecord));
+    assert(record != NULL);
+    record->owner = self;
+    record->next = __atomic_load_n(&list->records, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&list->records, &record->next, record, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+    return record;
+}
+
+static __LinkedListEpochRecord *__linkedlist_epoch_enter(LinkedListLockFree *list) {
+    __LinkedListEpochRecord *record = __linkedlist_epoch_record(list);
+    size_t epoch;
+    do {
+        epoch = __atomic_load_n(&list->epoch, __ATOMIC_SEQ_CST);
+        __atomic_store_n(&record->state, (epoch << 1) | 1, __ATOMIC_SEQ_CST);
+    } while (__atomic_load_n(&list->epoch, __ATOMIC_SEQ_CST) != epoch);
+
+    if (epoch != record->epoch) {
+        // the nodes retired two epochs ago or earlier can't be reached anymore
+        for (size_t i = 0; i < 3; i++) {
+            if (record->retired[i] != NULL && record->retired_epoch[i] + 2 <= epoch) {
+                __linkedlist_free_retired(record->retired[i]);
+                record->retired[i] = NULL;
+            }
+        }
+        record->epoch = epoch;
+    }
+    return record;
+}
+
+static void __linkedlist_epoch_exit(__LinkedListEpochRecord *record) {
+    __atomic_store_n(&record->state, 0, __ATOMIC_RELEASE);
+}
+
+static void __linkedlist_epoch_try_advance(LinkedListLockFree *list, size_t epoch) {
+    for (__LinkedListEpochRecord *record = __atomic_load_n(&list->records, __ATOMIC_ACQUIRE); record != NULL; record = record->next) {
+        size_t state = __atomic_load_n(&record->state, __ATOMIC_SEQ_CST);
+        if ((state & 1) && (state >> 1) != epoch) return;
+    }
+    __atomic_compare_exchange_n(&list->epoch, &epoch, epoch + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+
+static void __linkedlist_epoch_retire(LinkedListLockFree *list, __LinkedListEpochRecord *record, __LinkedListLockFreeNode *node) {
+    // the global epoch once the node is unlinked, the thread's own epoch may be one behind it
+    size_t epoch = __atomic_load_n(&list->epoch, __ATOMIC_SEQ_CST);
+    node->retired_next = record->retired[epoch % 3];
+    record->retired[epoch % 3] = node;
+    record->retired_epoch[epoch % 3] = epoch;
+    if (++record->retired_count % __LINKEDLIST_LOCKFREE_RETIRE_THRESHOLD == 0) {
+        __linkedlist_epoch_try_advance(list, epoch);
+    }
+}
+
+// Finds the first node not ordered before the value, unlinking the deleted nodes met on the way.
+// Sets the link pointing to it and the node (NULL at the end), and returns whether it equals the value.
+static bool __linkedlist_lockfree_find(LinkedListLockFree *list, __LinkedListEpochRecord *record, const void *value, uintptr_t **link_result, __LinkedListLockFreeNode **node_result) {
+retry:;
+    uintptr_t *link = &list->head;
+    __LinkedListLockFreeNode *node = (__LinkedListLockFreeNode *)__atomic_load_n(link, __ATOMIC_ACQUIRE);
+    while (node != NULL) {
+        uintptr_t next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+        if (next & __LINKEDLIST_LOCKFREE_MARK) {
+            uintptr_t expected = (uintptr_t)node;
+            // fails if the link changed or its own node got deleted meanwhile
+            if (!__atomic_compare_exchange_n(link, &expected, next & ~__LINKEDLIST_LOCKFREE_MARK, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                goto retry;
+            }
+            __linkedlist_epoch_retire(list, record, node);
+            node = (__LinkedListLockFreeNode *)(next & ~__LINKEDLIST_LOCKFREE_MARK);
+            continue;
+        }
+        int order = list->ordering_comparator(node->element, value);
+        if (order >= 0) {
+            *link_result = link;
+            *node_result = node;
+            return order == 0;
+        }
+        link = &node->next;
+        node = (__LinkedListLockFreeNode *)next;
+    }
+    *link_result = link;
+    *node_result = NULL;
+    return false;
+}
+
+LinkedListLockFree *__linkedlist_init_lockfree(size_t element_size, int (*ordering_comparator)(const void *, const void *)) {
+    assert(ordering_comparator != NULL);
+    LinkedListLockFree *list = malloc(sizeof(LinkedListLockFree));
+    assert(list != NULL);
+    list->head = 0;
+    list->element_size = element_size;
+    list->ordering_comparator = ordering_comparator;
+    list->length = 0;
+    list->epoch = 0;
+    list->records = NULL;
+    return list;
+}
+
+void LinkedList_lockfree_destroy(LinkedListLockFree **list_ptr) {
+    assert((list_ptr != NULL) && (*list_ptr != NULL));
+    LinkedListLockFree *list = *list_ptr;
+    __LinkedListEpochRecord *record = list->records;
+    while (record != NULL) {
+        __LinkedListEpochRecord *next_record = record->next;
+        for (size_t i = 0; i < 3; i++) {
+            __linkedlist_free_retired(record->retired[i]);
+        }
+        free(record);
+        record = next_record;
+    }
+    __LinkedListLockFreeNode *node = (__LinkedListLockFreeNode *)(list->head & ~__LINKEDLIST_LOCKFREE_MARK);
+    while (node != NULL) {
+        __LinkedListLockFreeNode *next_node = (__LinkedListLockFreeNode *)(node->next & ~__LINKEDLIST_LOCKFREE_MARK);
+        free(node);
+        node = next_node;
+    }
+    free(list);
+    *list_ptr = NULL;
+}
+
+size_t LinkedList_lockfree_length(const LinkedListLockFree *list) {
+    assert(list != NULL);
+    return __atomic_load_n(&list->length, __ATOMIC_RELAXED);
+}
+
+bool LinkedList_lockfree_insert_sorted(LinkedListLockFree *list, const void *element) {
+    assert(list != NULL);
+    assert(element != NULL);
+    __LinkedListLockFreeNode *new_node = malloc(sizeof(__LinkedListLockFreeNode) + list->element_size);
+    assert(new_node != NULL);
+    memcpy(new_node->element, element, list->element_size);
+    __LinkedListEpochRecord *record = __linkedlist_epoch_enter(list);
+    bool inserted = false;
+    for (;;) {
+        uintptr_t *link;
+        __LinkedListLockFreeNode *node;
+        if (__linkedlist_lockfree_find(list, record, element, &link, &node)) break;
+        new_node->next = (uintptr_t)node;
+        uintptr_t expected = (uintptr_t)node;
+        if (__atomic_compare_exchange_n(link, &expected, (uintptr_t)new_node, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            inserted = true;
+            break;
+        }
+    }
+    __linkedlist_epoch_exit(record);
+    if (inserted) {
+        __atomic_fetch_add(&list->length, 1, __ATOMIC_RELAXED);
+    } else {
+        free(new_node);
+    }
+    return inserted;
+}
+
+bool LinkedList_lockfree_remove_value(LinkedListLockFree *list, const void *value, void *element) {
+    assert(list != NULL);
+    assert(value != NULL);
+    __LinkedListEpochRecord *record = __linkedlist_epoch_enter(list);
+    bool removed = false;
+    for (;;) {
+        uintptr_t *link;
+        __LinkedListLockFreeNode *node;
+        if (!__linkedlist_lockfree_find(list, record, value, &link, &node)) break;
+        uintptr_t next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+        if (next & __LINKEDLIST_LOCKFREE_MARK) continue; // another thread is removing it, find unlinks it
+        if (!__atomic_compare_exchange_n(&node->next, &next, next | __LINKEDLIST_LOCKFREE_MARK, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) continue;
+        // the node is deleted from here on, copied before it can be retired
+        if (element != NULL) {
+            memcpy(element, node->element, list->element_size);
+        }
+        removed = true;
+        uintptr_t expected = (uintptr_t)node;
+        if (__atomic_compare_exchange_n(link, &expected, next, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            __linkedlist_epoch_retire(list, record, node);
+        } else {
+            __linkedlist_lockfree_find(list, record, value, &link, &node);
+        }
+        break;
+    }
+    __linkedlist_epoch_exit(record);
+    if (removed) {
+        __atomic_fetch_sub(&list->length, 1, __ATOMIC_RELAXED);
+    }
+    return removed;
+}
+
+bool LinkedList_lockfree_contains(LinkedListLockFree *list, const void *value) {
+    assert(list != NULL);
+    assert(value != NULL);
+    __LinkedListEpochRecord *record = __linkedlist_epoch_enter(list);
+    // lock-free like the writers (entering the epoch can retry), but the traversal itself skips the deleted nodes instead of unlinking them
+    __LinkedListLockFreeNode *node = (__LinkedListLockFreeNode *)__atomic_load_n(&list->head, __ATOMIC_ACQUIRE);
+    int order = -1;
+    while (node != NULL && (order = list->ordering_comparator(node->element, value)) < 0) {
+        node = (__LinkedListLockFreeNode *)(__atomic_load_n(&node->next, __ATOMIC_ACQUIRE) & ~__LINKEDLIST_LOCKFREE_MARK);
+    }
+    bool found = node != NULL && order == 0 && !(__atomic_load_n(&node->next, __ATOMIC_ACQUIRE) & __LINKEDLIST_LOCKFREE_MARK);
+    __linkedlist_epoch_exit(record);
+    return found;
+}
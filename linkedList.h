@@ -8,6 +8,8 @@ extern "C" {
 #endif
 
 #include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
@@ -30,6 +32,21 @@ typedef struct __Node {
  */
 __Node *__node_init(size_t element_size);
 
+/**
+ * Private
+ * 
+ * Frees a chain of nodes linked through their next pointers.
+ * @param node [__Node *] The first node of the chain, may be NULL.
+ */
+void __node_free_chain(__Node *node);
+
+/**
+ * The reference count of a chain of nodes shared by copy-on-write copies of a list.
+ */
+typedef struct __LinkedListShare {
+    size_t reference_count; // atomic
+} __LinkedListShare;
+
 typedef struct LinkedList {
     __Node *head;
     __Node *tail;
@@ -37,6 +54,7 @@ typedef struct LinkedList {
     size_t length;
     size_t element_size;
     size_t cached_index;
+    __LinkedListShare *share; // NULL unless the nodes are shared with copy-on-write copies
 } LinkedList;
 
 /**
@@ -49,6 +67,37 @@ typedef struct LinkedList {
  */
 LinkedList *__linkedlist_init(size_t element_size);
 
+/**
+ * Private
+ * 
+ * Creates a copy-on-write copy of the list, sharing its nodes.
+ * @param list_ptr [T **] A reference to the list.
+ * @return [LinkedList *] The new list.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If malloc fails.
+ */
+LinkedList *__linkedlist_cow_copy(void *list_ptr);
+
+/**
+ * Private
+ * 
+ * Gives the list its own nodes before it gets modified, copying them if they are shared with another list.
+ * Every operation that modifies the nodes (their links or their elements) calls it first.
+ * @param list [LinkedList *] The list.
+ * @throw [assert] If malloc fails.
+ */
+void __linkedlist_detach(LinkedList *list);
+
+/**
+ * Private
+ * 
+ * Drops the reference of the list to its nodes before they get freed.
+ * @param list [LinkedList *] The list.
+ * @return [bool] Whether the list was the last owner of its nodes, in which case the caller frees them.
+ */
+bool __linkedlist_release(LinkedList *list);
+
 /**
  * Public
  * 
@@ -110,6 +159,201 @@ bool LinkedList_is_empty(void *list_ptr);
  */
 void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **result, int *direction, size_t *result_index);
 
+/**
+ * Private
+ * 
+ * Walks to the node at the specified index from the nearest known node, and caches it.
+ * @param list_ptr [T **] A reference to the list.
+ * @param index [size_t] The index of the node.
+ * @return [__Node *] The node at the specified index.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the index is out of bounds.
+ */
+__Node *__linkedlist_node_at(void *list_ptr, size_t index);
+
+/**
+ * Private
+ * 
+ * Links an already allocated node at the specified index.
+ * @param list_ptr [T **] A reference to the list.
+ * @param index [size_t] The index to insert the node at.
+ * @param node [__Node *] The node.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the index is out of bounds.
+ * @throw [assert] If the node is NULL.
+ */
+void __linkedlist_insert_node(void *list_ptr, size_t index, __Node *node);
+
+/**
+ * Private
+ * 
+ * Inserts a node with an uninitialized element at the specified index.
+ * @param list_ptr [T **] A reference to the list.
+ * @param index [size_t] The index to insert the element at.
+ * @return [void *] A reference to the uninitialized element inside the new node.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the index is out of bounds.
+ * @throw [assert] If malloc fails.
+ */
+void *__linkedlist_emplace_at(void *list_ptr, size_t index);
+
+/**
+ * Private
+ * 
+ * Gets a reference to the element at the specified index, the node is reached like in LinkedList_get and cached.
+ * @param list_ptr [T **] A reference to the list.
+ * @param index [size_t] The index of the element.
+ * @return [void *] A reference to the element.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the index is out of bounds.
+ */
+void *__linkedlist_element_ref(void *list_ptr, size_t index);
+
+/**
+ * Private
+ * 
+ * Gets a reference to the first element.
+ * @param list_ptr [T **] A reference to the list.
+ * @return [void *] A reference to the element.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the list is empty.
+ */
+void *__linkedlist_front_ref(void *list_ptr);
+
+/**
+ * Private
+ * 
+ * Gets a reference to the last element.
+ * @param list_ptr [T **] A reference to the list.
+ * @return [void *] A reference to the element.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the list is empty.
+ */
+void *__linkedlist_back_ref(void *list_ptr);
+
+/**
+ * Public
+ * 
+ * Pushes a copy of the referenced element to the end of the list, with a single memcpy.
+ * @param list_ptr [T **] A reference to the list.
+ * @param element [const T *] A reference to the element to push.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the element is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void LinkedList_push_ptr(void *list_ptr, const void *element);
+
+/**
+ * Public
+ * 
+ * Copies the elements at the given indices into an array, in the order of the indices.
+ * The indices get visited in ascending order (sorted internally when they are not already), each one reached from the previous one or from the tail,
+ * so the whole batch costs one sweep of the list instead of a walk per index.
+ * @param list_ptr [T **] A reference to the list.
+ * @param indices [const size_t *] The indices of the elements to get, they can repeat.
+ * @param count [size_t] The number of indices.
+ * @param elements [T *] The array to copy the elements into, elements[i] receives the element at indices[i].
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the indices or the array are NULL (while count is not 0).
+ * @throw [assert] If an index is out of bounds.
+ */
+void LinkedList_get_many(void *list_ptr, const size_t *indices, size_t count, void *elements);
+
+/**
+ * Public
+ * 
+ * Sets the elements at the given indices to the elements of an array, in one sweep of the list like LinkedList_get_many.
+ * When an index repeats, the element that comes last in the array is kept, as with successive calls to LinkedList_set.
+ * @param list_ptr [T **] A reference to the list.
+ * @param indices [const size_t *] The indices of the elements to set.
+ * @param count [size_t] The number of indices.
+ * @param elements [const T *] The new elements, elements[i] gets copied to the index indices[i].
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the indices or the array are NULL (while count is not 0).
+ * @throw [assert] If an index is out of bounds.
+ */
+void LinkedList_set_many(void *list_ptr, const size_t *indices, size_t count, const void *elements);
+
+/**
+ * Public
+ * 
+ * Inserts the elements of an array at the given positions of the list, in a single forward walk.
+ * Every position refers to the list as it was before the call (elements[i] ends up before the element that was at positions[i], or at the end for the length),
+ * and the elements inserted at the same position keep the order of the array.
+ * @param list_ptr [T **] A reference to the list.
+ * @param positions [const size_t *] The positions to insert the elements at, from 0 to the length of the list.
+ * @param elements [const T *] The elements to insert.
+ * @param count [size_t] The number of elements.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the positions or the elements are NULL (while count is not 0).
+ * @throw [assert] If a position is out of bounds.
+ * @throw [assert] If malloc fails.
+ */
+void LinkedList_insert_many(void *list_ptr, const size_t *positions, const void *elements, size_t count);
+
+/**
+ * Public
+ * 
+ * Rotates the list in place by relinking its ends, the element at the index steps (modulo the length) becomes the first one,
+ * so a positive number of steps moves the first elements to the end and a negative one moves the last elements to the front.
+ * Only the walk to the new first node costs anything, from the nearest known node, nothing is allocated or copied.
+ * @param list_ptr [T **] A reference to the list.
+ * @param steps [ptrdiff_t] The number of steps to rotate the list by.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ */
+void LinkedList_rotate(void *list_ptr, ptrdiff_t steps);
+
+/**
+ * Public
+ * 
+ * Swaps the elements at two indices by relinking their nodes, nothing is allocated or copied.
+ * @param list_ptr [T **] A reference to the list.
+ * @param index1 [size_t] The index of the first element.
+ * @param index2 [size_t] The index of the second element.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If an index is out of bounds.
+ */
+void LinkedList_swap(void *list_ptr, size_t index1, size_t index2);
+
+/**
+ * Public
+ * 
+ * Moves the element at an index so it ends up at another index, shifting the elements in between, by relinking its node, nothing is allocated or copied.
+ * @param list_ptr [T **] A reference to the list.
+ * @param from [size_t] The index of the element to move.
+ * @param to [size_t] The index of the element once moved.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If an index is out of bounds.
+ */
+void LinkedList_move(void *list_ptr, size_t from, size_t to);
+
+/**
+ * Public
+ * 
+ * Removes up to count elements from the front of the list in a single pass, copying them into an array, to drain a queue in bulk.
+ * The cached node stays cached unless it is one of the removed ones.
+ * @param list_ptr [T **] A reference to the list.
+ * @param count [size_t] The maximum number of elements to remove.
+ * @param elements [T *] The array to copy the removed elements into, in order, if NULL the elements are discarded.
+ * @return [size_t] The number of removed elements, the smaller of count and the length of the list.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ */
+size_t LinkedList_pop_front_n(void *list_ptr, size_t count, void *elements);
+
 /**
  * Public
  * 
@@ -131,11 +375,8 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
 #define LinkedList_destroy(__list_ptr__) do { \
     assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
     LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-    __Node *__current_node__ = __temp_list__->head; \
-    while (__current_node__ != NULL) { \
-        __Node *__next_node__ = __current_node__->next; \
-        free(__current_node__); \
-        __current_node__ = __next_node__; \
+    if (__linkedlist_release(__temp_list__)) { \
+        __node_free_chain(__temp_list__->head); \
     } \
     free(__temp_list__); \
     *(__list_ptr__) = NULL; \
@@ -289,6 +530,89 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
     #endif
 #endif
 
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Gets a reference to the element at the specified index, so it can be read or modified without being copied.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __index__ [size_t] The index of the element.
+     * @return [T *] A reference to the element inside its node, valid until the node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the index is out of bounds.
+     */
+    #define LinkedList_get_ref(__list_ptr__, __index__) ((typeof(**(__list_ptr__)) *)__linkedlist_element_ref((__list_ptr__), (__index__)))
+#else
+    /**
+     * Public
+     * 
+     * Gets a reference to the element at the specified index, so it can be read or modified without being copied.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __index__ [size_t] The index of the element.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @return [T *] A reference to the element inside its node, valid until the node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the index is out of bounds.
+     */
+    #define LinkedList_get_ref(__list_ptr__, __index__, __list_element_type__) ((__list_element_type__ *)__linkedlist_element_ref((__list_ptr__), (__index__)))
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Gets a reference to the first element in O(1).
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @return [T *] A reference to the element inside its node, valid until the node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the list is empty.
+     */
+    #define LinkedList_front_ref(__list_ptr__) ((typeof(**(__list_ptr__)) *)__linkedlist_front_ref(__list_ptr__))
+#else
+    /**
+     * Public
+     * 
+     * Gets a reference to the first element in O(1).
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @return [T *] A reference to the element inside its node, valid until the node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the list is empty.
+     */
+    #define LinkedList_front_ref(__list_ptr__, __list_element_type__) ((__list_element_type__ *)__linkedlist_front_ref(__list_ptr__))
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Gets a reference to the last element in O(1).
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @return [T *] A reference to the element inside its node, valid until the node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the list is empty.
+     */
+    #define LinkedList_back_ref(__list_ptr__) ((typeof(**(__list_ptr__)) *)__linkedlist_back_ref(__list_ptr__))
+#else
+    /**
+     * Public
+     * 
+     * Gets a reference to the last element in O(1).
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @return [T *] A reference to the element inside its node, valid until the node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the list is empty.
+     */
+    #define LinkedList_back_ref(__list_ptr__, __list_element_type__) ((__list_element_type__ *)__linkedlist_back_ref(__list_ptr__))
+#endif
+
 #if COMPILER_SUPPORTS_TYPEOF
     /**
      * Public
@@ -305,6 +629,7 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
     #define LinkedList_set(__list_ptr__, __index__, __element__) do { \
         assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
         LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
         assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
         assert(__temp_list__->element_size == sizeof(__element__)); \
         __Node *__nearest_node__ = NULL; \
@@ -344,6 +669,7 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
     #define LinkedList_set(__list_ptr__, __index__, __element__, __list_element_type__) do { \
         assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
         LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
         assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
         assert(__temp_list__->element_size == sizeof(__element__)); \
         __Node *__nearest_node__ = NULL; \
@@ -509,61 +835,98 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
     #endif
 #endif
 
+/**
+ * The index returned by LinkedList_find when no element satisfies the boolean comparator.
+ */
+#define LINKEDLIST_NOT_FOUND ((size_t)-1)
+
+/**
+ * Private
+ * 
+ * Walks from the node at the start index, reached from the nearest known node, forward or backward until an element satisfies the boolean comparator,
+ * and caches the matching node.
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @param __start__ [size_t] The index of the first element to compare, a start out of bounds matches nothing.
+ * @param __element__ [T] The element to search for.
+ * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __backward__ [bool] Whether to walk toward the head instead of the tail.
+ * @param __index_reference__ [size_t *] A reference to the variable to store the index of the matching element, or LINKEDLIST_NOT_FOUND.
+ */
+#define __LinkedList_search__(__list_ptr__, __start__, __element__, __boolean_comparator__, __list_element_type__, __backward__, __index_reference__) do { \
+    LinkedList *__search_list__ = (LinkedList *)(*(__list_ptr__)); \
+    __list_element_type__ __search_element__ = (__element__); \
+    size_t __search_index__ = (__start__); \
+    *(__index_reference__) = LINKEDLIST_NOT_FOUND; \
+    if (__search_index__ < __search_list__->length) { \
+        __Node *__search_node__ = __linkedlist_node_at(__list_ptr__, __search_index__); \
+        while (__search_node__ != NULL) { \
+            if ((__boolean_comparator__)(*((__list_element_type__ *)__search_node__->element), __search_element__)) { \
+                __search_list__->cached = __search_node__; \
+                __search_list__->cached_index = __search_index__; \
+                *(__index_reference__) = __search_index__; \
+                break; \
+            } \
+            if (__backward__) { \
+                __search_node__ = __search_node__->previous; \
+                __search_index__--; \
+            } else { \
+                __search_node__ = __search_node__->next; \
+                __search_index__++; \
+            } \
+        } \
+    } \
+} while (0)
+
 #if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
     #if COMPILER_SUPPORTS_TYPEOF
         /**
          * Public
          * 
-         * Counts the elements that satisfy the boolean comparator.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator,
+         * walking to the start index from the nearest known node (head, tail or the cached node) instead of the head.
          * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The index to start searching from.
          * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
-         * @return [size_t] The count of the elements.
+         * @return [size_t] The index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element is not found.
          */
-        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__) ({ \
+        #define LinkedList_index_from(__list_ptr__, __start__, __element__, __boolean_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __temp_list__->head; \
-            size_t __count__ = 0; \
-            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
-                if ((__boolean_comparator__)(*((typeof(**(__list_ptr__)) *)__node__->element), (__element__))) { \
-                    __count__++; \
-                } \
-                __node__ = __node__->next; \
-            } \
-            __count__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), typeof(**(__list_ptr__)), false, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            __found_index__; \
         })
     #else
         /**
          * Public
          * 
-         * Counts the elements that satisfy the boolean comparator.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator,
+         * walking to the start index from the nearest known node (head, tail or the cached node) instead of the head.
          * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The index to start searching from.
          * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [size_t] The count of the elements.
+         * @return [size_t] The index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element is not found.
          */
-        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__, __list_element_type__) ({ \
+        #define LinkedList_index_from(__list_ptr__, __start__, __element__, __boolean_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __temp_list__->head; \
-            size_t __count__ = 0; \
-            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
-                if ((__boolean_comparator__)(*((__list_element_type__ *)__node__->element), (__element__))) { \
-                    __count__++; \
-                } \
-                __node__ = __node__->next; \
-            } \
-            __count__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), __list_element_type__, false, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            __found_index__; \
         })
     #endif
 #else
@@ -571,366 +934,103 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Counts the elements that satisfy the boolean comparator.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator,
+         * walking to the start index from the nearest known node (head, tail or the cached node) instead of the head.
          * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The index to start searching from.
          * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
-         * @param __result_ptr__ [size_t *] A reference to the result.
-         * @return [size_t] The count of the elements.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If the result reference is NULL.
+         * @throw [assert] If the element is not found.
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__) do { \
+        #define LinkedList_index_from(__list_ptr__, __start__, __element__, __boolean_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __temp_list__->head; \
-            size_t __count__ = 0; \
-            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
-                if ((__boolean_comparator__)(*((typeof(**(__list_ptr__)) *)__node__->element), (__element__))) { \
-                    __count__++; \
-                } \
-                __node__ = __node__->next; \
-            } \
-            *(__result_ptr__) = __count__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), typeof(**(__list_ptr__)), false, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            *(__result_ptr__) = __found_index__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Counts the elements that satisfy the boolean comparator.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator,
+         * walking to the start index from the nearest known node (head, tail or the cached node) instead of the head.
          * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The index to start searching from.
          * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
-         * @param __result_ptr__ [size_t *] A reference to the result.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [size_t] The count of the elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If the result reference is NULL.
+         * @throw [assert] If the element is not found.
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_index_from(__list_ptr__, __start__, __element__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __temp_list__->head; \
-            size_t __count__ = 0; \
-            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
-                if ((__boolean_comparator__)(*((__list_element_type__ *)__node__->element), (__element__))) { \
-                    __count__++; \
-                } \
-                __node__ = __node__->next; \
-            } \
-            *(__result_ptr__) = __count__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), __list_element_type__, false, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            *(__result_ptr__) = __found_index__; \
         } while(0)
     #endif
 #endif
 
-#if COMPILER_SUPPORTS_TYPEOF
-    /**
-     * Public
-     * 
-     * Pushes an element to the end of the list.
-     * @param __list_ptr__ [T **] A reference to the list.
-     * @param __element__ [T] The element to push.
-     * @throw [assert] If the reference to the list is NULL.
-     * @throw [assert] If the list is NULL.
-     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-     * @throw [assert] If malloc fails.
-     */
-    #define LinkedList_push(__list_ptr__, __element__) do { \
-        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        assert(__temp_list__->element_size == sizeof(__element__)); \
-        __Node *__node__ = __node_init(__temp_list__->element_size); \
-        __node__->previous = __temp_list__->tail; \
-        *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
-        if (__temp_list__->head == NULL) { \
-            __temp_list__->head = __node__; \
-        } else { \
-            __temp_list__->tail->next = __node__; \
-        } \
-        __temp_list__->tail = __node__; \
-        __temp_list__->length++; \
-    } while(0)
-#else
-    /**
-     * Public
-     * 
-     * Pushes an element to the end of the list.
-     * @param __list_ptr__ [T **] A reference to the list.
-     * @param __element__ [T] The element to push.
-     * @param __list_element_type__ [type] The type of the elements in the list.
-     * @throw [assert] If the reference to the list is NULL.
-     * @throw [assert] If the list is NULL.
-     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-     * @throw [assert] If malloc fails.
-     */
-    #define LinkedList_push(__list_ptr__, __element__, __list_element_type__) do { \
-        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        assert(__temp_list__->element_size == sizeof(__element__)); \
-        __Node *__node__ = __node_init(__temp_list__->element_size); \
-        __node__->previous = __temp_list__->tail; \
-        *((__list_element_type__ *)__node__->element) = (__element__); \
-        if (__temp_list__->head == NULL) { \
-            __temp_list__->head = __node__; \
-        } else { \
-            __temp_list__->tail->next = __node__; \
-        } \
-        __temp_list__->tail = __node__; \
-        __temp_list__->length++; \
-    } while(0)
-#endif
-
-#if COMPILER_SUPPORTS_TYPEOF
-    /**
-     * Public
-     * 
-     * Inserts an element at the specified index.
-     * @param __list_ptr__ [T **] A reference to the list.
-     * @param __index__ [size_t] The index to insert the element at.
-     * @param __element__ [T] The element to insert.
-     * @throw [assert] If the reference to the list is NULL.
-     * @throw [assert] If the list is NULL.
-     * @throw [assert] If the index is out of bounds.
-     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-     * @throw [assert] If malloc fails.
-     */
-    #define LinkedList_insert_at(__list_ptr__, __index__, __element__) do { \
-        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        assert((__index__ >= 0) && (__index__ <= __temp_list__->length)); \
-        assert(__temp_list__->element_size == sizeof(__element__)); \
-        __Node *__node__ = __node_init(__temp_list__->element_size); \
-        *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
-        if (__index__ == 0) { \
-            __node__->next = __temp_list__->head; \
-            if (__temp_list__->head) { \
-                __temp_list__->head->previous = __node__; \
-            } \
-            __temp_list__->head = __node__; \
-            if (!__temp_list__->tail) { \
-                __temp_list__->tail = __node__; \
-            } \
-            __temp_list__->cached_index++; \
-        } else if (__index__ == __temp_list__->length) { \
-            __node__->previous = __temp_list__->tail; \
-            if (__temp_list__->tail) { \
-                __temp_list__->tail->next = __node__; \
-            } \
-            __temp_list__->tail = __node__; \
-            if (!__temp_list__->head) { \
-                __temp_list__->head = __node__; \
-            } \
-        } else { \
-            __Node *__nearest_node__ = NULL; \
-            int __direction__ = 0; \
-            size_t __nearest_node_index__ = 0; \
-            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
-            if (__direction__ == 1) { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->next; \
-                    __nearest_node_index__++; \
-                } \
-            } else { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->previous; \
-                    __nearest_node_index__--; \
-                } \
-            } \
-            __node__->next = __nearest_node__; \
-            __node__->previous = __nearest_node__->previous; \
-            if (__nearest_node__->previous) { \
-                __nearest_node__->previous->next = __node__; \
-            } \
-            __nearest_node__->previous = __node__; \
-            __temp_list__->cached = __node__; \
-            __temp_list__->cached_index = __index__; \
-        } \
-        __temp_list__->length++; \
-    } while(0)
-
-#else
-    /**
-     * Public
-     * 
-     * Inserts an element at the specified index.
-     * @param __list_ptr__ [T **] A reference to the list.
-     * @param __index__ [size_t] The index to insert the element at.
-     * @param __element__ [T] The element to insert.
-     * @param __list_element_type__ [type] The type of the elements in the list.
-     * @throw [assert] If the reference to the list is NULL.
-     * @throw [assert] If the list is NULL.
-     * @throw [assert] If the index is out of bounds.
-     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-     * @throw [assert] If malloc fails.
-     */
-    #define LinkedList_insert_at(__list_ptr__, __index__, __element__, __list_element_type__) do { \
-        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        assert((__index__ >= 0) && (__index__ <= __temp_list__->length)); \
-        assert(__temp_list__->element_size == sizeof(__element__)); \
-        __Node *__node__ = __node_init(__temp_list__->element_size); \
-        *((__list_element_type__ *)__node__->element) = (__element__); \
-        if (__index__ == 0) { \
-            __node__->next = __temp_list__->head; \
-            if (__temp_list__->head) { \
-                __temp_list__->head->previous = __node__; \
-            } \
-            __temp_list__->head = __node__; \
-            if (!__temp_list__->tail) { \
-                __temp_list__->tail = __node__; \
-            } \
-            __temp_list__->cached_index++; \
-        } else if (__index__ == __temp_list__->length) { \
-            __node__->previous = __temp_list__->tail; \
-            if (__temp_list__->tail) { \
-                __temp_list__->tail->next = __node__; \
-            } \
-            __temp_list__->tail = __node__; \
-            if (!__temp_list__->head) { \
-                __temp_list__->head = __node__; \
-            } \
-        } else { \
-            __Node *__nearest_node__ = NULL; \
-            int __direction__ = 0; \
-            size_t __nearest_node_index__ = 0; \
-            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
-            if (__direction__ == 1) { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->next; \
-                    __nearest_node_index__++; \
-                } \
-            } else { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->previous; \
-                    __nearest_node_index__--; \
-                } \
-            } \
-            __node__->next = __nearest_node__; \
-            __node__->previous = __nearest_node__->previous; \
-            if (__nearest_node__->previous) { \
-                __nearest_node__->previous->next = __node__; \
-            } \
-            __nearest_node__->previous = __node__; \
-            __temp_list__->cached = __node__; \
-            __temp_list__->cached_index = __index__; \
-        } \
-        __temp_list__->length++; \
-    } while(0)
-#endif
-
 #if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
     #if COMPILER_SUPPORTS_TYPEOF
         /**
          * Public
          * 
-         * Inserts an element at the correct position given an ordered list.
+         * Gets the index of the last element that satisfies the boolean comparator, walking backward from the tail.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to insert.
-         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
-         * @return [size_t] The index where the element was inserted.
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @return [size_t] The index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not found.
          */
-        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__) ({ \
+        #define LinkedList_rindex(__list_ptr__, __element__, __boolean_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __node_init(__temp_list__->element_size); \
-            *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
-            size_t __insert_index__ = 0; \
-            if (__temp_list__->head == NULL) { \
-                __temp_list__->head = __node__; \
-                __temp_list__->tail = __node__; \
-            } else { \
-                __Node *__current_node__ = __temp_list__->head; \
-                while (__current_node__ != NULL) { \
-                    if ((__ordering_comparator__)(*((typeof(**(__list_ptr__)) *)__current_node__->element), (__element__)) >= 0) { \
-                        if (__current_node__->previous != NULL) { \
-                            __current_node__->previous->next = __node__; \
-                            __node__->previous = __current_node__->previous; \
-                        } else { \
-                            __temp_list__->head = __node__; \
-                        } \
-                        __node__->next = __current_node__; \
-                        __current_node__->previous = __node__; \
-                        break; \
-                        __temp_list__->cached = __node__; \
-                        __temp_list__->cached_index = __insert_index__; \
-                    } \
-                    __current_node__ = __current_node__->next; \
-                    __insert_index__++; \
-                } \
-                if (__current_node__ == NULL) { \
-                    __temp_list__->tail->next = __node__; \
-                    __node__->previous = __temp_list__->tail; \
-                    __temp_list__->tail = __node__; \
-                } \
-            } \
-            __temp_list__->length++; \
-            __insert_index__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, ((LinkedList *)(*(__list_ptr__)))->length - 1, (__element__), (__boolean_comparator__), typeof(**(__list_ptr__)), true, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            __found_index__; \
         })
     #else
         /**
          * Public
          * 
-         * Inserts an element at the correct position given an ordered list.
+         * Gets the index of the last element that satisfies the boolean comparator, walking backward from the tail.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to insert.
-         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [size_t] The index where the element was inserted.
+         * @return [size_t] The index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not found.
          */
-        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__, __list_element_type__) ({ \
+        #define LinkedList_rindex(__list_ptr__, __element__, __boolean_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __node_init(__temp_list__->element_size); \
-            *((__list_element_type__ *)__node__->element) = (__element__); \
-            size_t __insert_index__ = 0; \
-            if (__temp_list__->head == NULL) { \
-                __temp_list__->head = __node__; \
-                __temp_list__->tail = __node__; \
-            } else { \
-                __Node *__current_node__ = __temp_list__->head; \
-                while (__current_node__ != NULL) { \
-                    if ((__ordering_comparator__)(*((__list_element_type__ *)__current_node__->element), (__element__)) >= 0) { \
-                        if (__current_node__->previous != NULL) { \
-                            __current_node__->previous->next = __node__; \
-                            __node__->previous = __current_node__->previous; \
-                        } else { \
-                            __temp_list__->head = __node__; \
-                        } \
-                        __node__->next = __current_node__; \
-                        __current_node__->previous = __node__; \
-                        break; \
-                        __temp_list__->cached = __node__; \
-                        __temp_list__->cached_index = __insert_index__; \
-                    } \
-                    __current_node__ = __current_node__->next; \
-                    __insert_index__++; \
-                } \
-                if (__current_node__ == NULL) { \
-                    __temp_list__->tail->next = __node__; \
-                    __node__->previous = __temp_list__->tail; \
-                    __temp_list__->tail = __node__; \
-                } \
-            } \
-            __temp_list__->length++; \
-            __insert_index__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, ((LinkedList *)(*(__list_ptr__)))->length - 1, (__element__), (__boolean_comparator__), __list_element_type__, true, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            __found_index__; \
         })
     #endif
 #else
@@ -938,202 +1038,99 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Inserts an element at the correct position given an ordered list.
+         * Gets the index of the last element that satisfies the boolean comparator, walking backward from the tail.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to insert.
-         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
-         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was inserted, if NULL the result will not be stored but the function will execute normally
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not found.
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__, __result_ptr__) do { \
+        #define LinkedList_rindex(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __node_init(__temp_list__->element_size); \
-            *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
-            size_t __insert_index__ = 0; \
-            if (__temp_list__->head == NULL) { \
-                __temp_list__->head = __node__; \
-                __temp_list__->tail = __node__; \
-            } else { \
-                __Node *__current_node__ = __temp_list__->head; \
-                while (__current_node__ != NULL) { \
-                    if ((__ordering_comparator__)(*((typeof(**(__list_ptr__)) *)__current_node__->element), (__element__)) >= 0) { \
-                        if (__current_node__->previous != NULL) { \
-                            __current_node__->previous->next = __node__; \
-                            __node__->previous = __current_node__->previous; \
-                        } else { \
-                            __temp_list__->head = __node__; \
-                        } \
-                        __node__->next = __current_node__; \
-                        __current_node__->previous = __node__; \
-                        break; \
-                        __temp_list__->cached = __node__; \
-                        __temp_list__->cached_index = __insert_index__; \
-                    } \
-                    __current_node__ = __current_node__->next; \
-                    __insert_index__++; \
-                } \
-                if (__current_node__ == NULL) { \
-                    __temp_list__->tail->next = __node__; \
-                    __node__->previous = __temp_list__->tail; \
-                    __temp_list__->tail = __node__; \
-                } \
-            } \
-            __temp_list__->length++; \
-            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __insert_index__; } \
+            assert((__result_ptr__) != NULL); \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, ((LinkedList *)(*(__list_ptr__)))->length - 1, (__element__), (__boolean_comparator__), typeof(**(__list_ptr__)), true, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            *(__result_ptr__) = __found_index__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Inserts an element at the correct position given an ordered list.
+         * Gets the index of the last element that satisfies the boolean comparator, walking backward from the tail.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to insert.
-         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
-         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was inserted, if NULL the result will not be stored but the function will execute normally
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element.
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not found.
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_rindex(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->element_size == sizeof(__element__)); \
-            __Node *__node__ = __node_init(__temp_list__->element_size); \
-            *((__list_element_type__ *)__node__->element) = (__element__); \
-            size_t __insert_index__ = 0; \
-            if (__temp_list__->head == NULL) { \
-                __temp_list__->head = __node__; \
-                __temp_list__->tail = __node__; \
-            } else { \
-                __Node *__current_node__ = __temp_list__->head; \
-                while (__current_node__ != NULL) { \
-                    if ((__ordering_comparator__)(*((__list_element_type__ *)__current_node__->element), (__element__)) >= 0) { \
-                        if (__current_node__->previous != NULL) { \
-                            __current_node__->previous->next = __node__; \
-                            __node__->previous = __current_node__->previous; \
-                        } else { \
-                            __temp_list__->head = __node__; \
-                        } \
-                        __node__->next = __current_node__; \
-                        __current_node__->previous = __node__; \
-                        break; \
-                        __temp_list__->cached = __node__; \
-                        __temp_list__->cached_index = __insert_index__; \
-                    } \
-                    __current_node__ = __current_node__->next; \
-                    __insert_index__++; \
-                } \
-                if (__current_node__ == NULL) { \
-                    __temp_list__->tail->next = __node__; \
-                    __node__->previous = __temp_list__->tail; \
-                    __temp_list__->tail = __node__; \
-                } \
-            } \
-            __temp_list__->length++; \
-            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __insert_index__; } \
+            assert((__result_ptr__) != NULL); \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, ((LinkedList *)(*(__list_ptr__)))->length - 1, (__element__), (__boolean_comparator__), __list_element_type__, true, &__found_index__); \
+            assert(__found_index__ != LINKEDLIST_NOT_FOUND); \
+            *(__result_ptr__) = __found_index__; \
         } while(0)
     #endif
 #endif
 
-/**
- * Public
- * 
- * Concatenates two lists.
- * @param __list_ptr1__ [T **] A reference to the first list.
- * @param __list_ptr2__ [T **] A reference to the second list.
- * @throw [assert] If the reference to the first list is NULL.
- * @throw [assert] If the first list is NULL.
- * @throw [assert] If the reference to the second list is NULL.
- * @throw [assert] If the second list is NULL.
- * @throw [assert] If the element sizes of the lists are not the same.
- * @throw [assert] If malloc fails.
- */
-#define LinkedList_concat(__list_ptr1__, __list_ptr2__) do { \
-    assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
-    assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
-    LinkedList *__temp_list1__ = (LinkedList *)(*(__list_ptr1__)); \
-    LinkedList *__temp_list2__ = (LinkedList *)(*(__list_ptr2__)); \
-    assert(__temp_list1__->element_size == __temp_list2__->element_size); \
-    __Node *__current_node__ = __temp_list2__->head; \
-    while (__current_node__ != NULL) { \
-        __Node *__node__ = __node_init(__temp_list1__->element_size); \
-        memcpy(__node__->element, __current_node__->element, __temp_list1__->element_size); \
-        if (__temp_list1__->head == NULL) { \
-            __temp_list1__->head = __node__; \
-        } else { \
-            __temp_list1__->tail->next = __node__; \
-            __node__->previous = __temp_list1__->tail; \
-        } \
-        __temp_list1__->tail = __node__; \
-        __temp_list1__->length++; \
-        __current_node__ = __current_node__->next; \
-    } \
-} while(0)
-
 #if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
     #if COMPILER_SUPPORTS_TYPEOF
         /**
          * Public
          * 
-         * Removes the last element from the list.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator, like LinkedList_index_from,
+         * but returns LINKEDLIST_NOT_FOUND instead of asserting when there is none (or when the start index is out of bounds).
          * @param __list_ptr__ [T **] A reference to the list.
-         * @return [T] The removed element.
+         * @param __start__ [size_t] The index to start searching from.
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @return [size_t] The index of the element, or LINKEDLIST_NOT_FOUND.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the list is empty.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          */
-        #define LinkedList_pop(__list_ptr__) ({ \
+        #define LinkedList_find(__list_ptr__, __start__, __element__, __boolean_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->length > 0); \
-            __Node *__node__ = __temp_list__->tail; \
-            typeof(**(__list_ptr__)) __element__ = *((typeof(**(__list_ptr__)) *)__node__->element); \
-            if (__node__->previous != NULL) { \
-                __node__->previous->next = NULL; \
-                __temp_list__->tail = __node__->previous; \
-            } else { \
-                __temp_list__->head = NULL; \
-                __temp_list__->tail = NULL; \
-            } \
-            __temp_list__->length--; \
-            free(__node__); \
-            __element__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), typeof(**(__list_ptr__)), false, &__found_index__); \
+            __found_index__; \
         })
     #else
         /**
          * Public
          * 
-         * Removes the last element from the list.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator, like LinkedList_index_from,
+         * but returns LINKEDLIST_NOT_FOUND instead of asserting when there is none (or when the start index is out of bounds).
          * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The index to start searching from.
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [T] The removed element.
+         * @return [size_t] The index of the element, or LINKEDLIST_NOT_FOUND.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the list is empty.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          */
-        #define LinkedList_pop(__list_ptr__, __list_element_type__) ({ \
+        #define LinkedList_find(__list_ptr__, __start__, __element__, __boolean_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->length > 0); \
-            __Node *__node__ = __temp_list__->tail; \
-            __list_element_type__ __element__ = *((__list_element_type__ *)__node__->element); \
-            if (__node__->previous != NULL) { \
-                __node__->previous->next = NULL; \
-                __temp_list__->tail = __node__->previous; \
-            } else { \
-                __temp_list__->head = NULL; \
-                __temp_list__->tail = NULL; \
-            } \
-            __temp_list__->length--; \
-            free(__node__); \
-            __element__; \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), __list_element_type__, false, &__found_index__); \
+            __found_index__; \
         })
     #endif
 #else
@@ -1141,171 +1138,121 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Removes the last element from the list.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator, like LinkedList_index_from,
+         * but returns LINKEDLIST_NOT_FOUND instead of asserting when there is none (or when the start index is out of bounds).
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
+         * @param __start__ [size_t] The index to start searching from.
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element, or LINKEDLIST_NOT_FOUND.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the list is empty.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_pop(__list_ptr__, __result_ptr__) do { \
+        #define LinkedList_find(__list_ptr__, __start__, __element__, __boolean_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->length > 0); \
-            __Node *__node__ = __temp_list__->tail; \
-            if (__result_ptr__ != NULL) { \
-                *(__result_ptr__) = *((typeof(**(__list_ptr__)) *)__node__->element); \
-            } \
-            if (__node__->previous != NULL) { \
-                __node__->previous->next = NULL; \
-                __temp_list__->tail = __node__->previous; \
-            } else { \
-                __temp_list__->head = NULL; \
-                __temp_list__->tail = NULL; \
-            } \
-            __temp_list__->length--; \
-            free(__node__); \
+            assert((__result_ptr__) != NULL); \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), typeof(**(__list_ptr__)), false, &__found_index__); \
+            *(__result_ptr__) = __found_index__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Removes the last element from the list.
+         * Gets the index of the first element at or after the start index that satisfies the boolean comparator, like LinkedList_index_from,
+         * but returns LINKEDLIST_NOT_FOUND instead of asserting when there is none (or when the start index is out of bounds).
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
+         * @param __start__ [size_t] The index to start searching from.
+         * @param __element__ [T] The element to search for.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element, or LINKEDLIST_NOT_FOUND.
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the list is empty.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_pop(__list_ptr__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_find(__list_ptr__, __start__, __element__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert(__temp_list__->length > 0); \
-            __Node *__node__ = __temp_list__->tail; \
-            if (__result_ptr__ != NULL) { \
-                *(__result_ptr__) = *((__list_element_type__ *) __node__->element); \
-            } \
-            if (__node__->previous != NULL) { \
-                __node__->previous->next = NULL; \
-                __temp_list__->tail = __node__->previous; \
-            } else { \
-                __temp_list__->head = NULL; \
-                __temp_list__->tail = NULL; \
-            } \
-            __temp_list__->length--; \
-            free(__node__); \
+            assert((__result_ptr__) != NULL); \
+            assert(((LinkedList *)(*(__list_ptr__)))->element_size == sizeof(__element__)); \
+            size_t __found_index__; \
+            __LinkedList_search__(__list_ptr__, (__start__), (__element__), (__boolean_comparator__), __list_element_type__, false, &__found_index__); \
+            *(__result_ptr__) = __found_index__; \
         } while(0)
     #endif
 #endif
 
-// in here i cannot use the same trick as list_pop because i don't have direct access to the element
 #if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
     #if COMPILER_SUPPORTS_TYPEOF
         /**
          * Public
          * 
-         * Removes the element at the specified index.
+         * Gets the index of the first element that satisfies the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __index__ [size_t] The index to remove the element from.
-         * @return [T] The removed element.
+         * @param __element_ptr__ [const T *] A reference to the element to search for.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
+         * @return [size_t] The index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the index is out of bounds.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element is not found.
          */
-        #define LinkedList_remove_at(__list_ptr__, __index__) ({ \
+        #define LinkedList_index_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
-            __Node *__nearest_node__ = NULL; \
-            int __direction__ = 0; \
-            size_t __nearest_node_index__ = 0; \
-            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
-            if (__direction__ == 1) { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->next; \
-                    __nearest_node_index__++; \
-                } \
-            } else { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->previous; \
-                    __nearest_node_index__--; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const typeof(**(__list_ptr__)) *)__node__->element, (__element_ptr__))) { \
+                    __found__ = true; \
+                    break; \
                 } \
+                __node__ = __node__->next; \
             } \
-            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
-                __temp_list__->cached = __nearest_node__->next; \
-                __temp_list__->cached_index = __index__; \
-            } else { \
-                __temp_list__->cached = NULL; \
-            } \
-            if (__nearest_node__->previous != NULL) { \
-                __nearest_node__->previous->next = __nearest_node__->next; \
-            } else { \
-                __temp_list__->head = __nearest_node__->next; \
-            } \
-            if (__nearest_node__->next != NULL) { \
-                __nearest_node__->next->previous = __nearest_node__->previous; \
-            } else { \
-                __temp_list__->tail = __nearest_node__->previous; \
-            } \
-            __temp_list__->length--; \
-            typeof(**(__list_ptr__)) __element__ = *((typeof(**(__list_ptr__)) *)__nearest_node__->element); \
-            free(__nearest_node__); \
-            __element__; \
+            assert(__found__); \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __i__; \
+            __i__; \
         })
-
     #else
         /**
          * Public
          * 
-         * Removes the element at the specified index.
+         * Gets the index of the first element that satisfies the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __index__ [size_t] The index to remove the element from.
+         * @param __element_ptr__ [const T *] A reference to the element to search for.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [T] The removed element.
+         * @return [size_t] The index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the index is out of bounds.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element is not found.
          */
-        #define LinkedList_remove_at(__list_ptr__, __index__, __list_element_type__) ({ \
+        #define LinkedList_index_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
-            __Node *__nearest_node__ = NULL; \
-            int __direction__ = 0; \
-            size_t __nearest_node_index__ = 0; \
-            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
-            if (__direction__ == 1) { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->next; \
-                    __nearest_node_index__++; \
-                } \
-            } else { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->previous; \
-                    __nearest_node_index__--; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const __list_element_type__ *)__node__->element, (__element_ptr__))) { \
+                    __found__ = true; \
+                    break; \
                 } \
+                __node__ = __node__->next; \
             } \
-            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
-                __temp_list__->cached = __nearest_node__->next; \
-                __temp_list__->cached_index = __index__; \
-            } else { \
-                __temp_list__->cached = NULL; \
-            } \
-            if (__nearest_node__->previous != NULL) { \
-                __nearest_node__->previous->next = __nearest_node__->next; \
-            } else { \
-                __temp_list__->head = __nearest_node__->next; \
-            } \
-            if (__nearest_node__->next != NULL) { \
-                __nearest_node__->next->previous = __nearest_node__->previous; \
-            } else { \
-                __temp_list__->tail = __nearest_node__->previous; \
-            } \
-            __temp_list__->length--; \
-            __list_element_type__ __element__ = *((__list_element_type__ *)__nearest_node__->element); \
-            free(__nearest_node__); \
-            __element__; \
+            assert(__found__); \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __i__; \
+            __i__; \
         })
     #endif
 #else
@@ -1313,108 +1260,72 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Removes the element at the specified index.
+         * Gets the index of the first element that satisfies the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __index__ [size_t] The index to remove the element from.
-         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
+         * @param __element_ptr__ [const T *] A reference to the element to search for.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the index is out of bounds.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element is not found.
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_remove_at(__list_ptr__, __index__, __result_ptr__) do { \
+        #define LinkedList_index_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
-            __Node *__nearest_node__ = NULL; \
-            int __direction__ = 0; \
-            size_t __nearest_node_index__ = 0; \
-            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
-            if (__direction__ == 1) { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->next; \
-                    __nearest_node_index__++; \
-                } \
-            } else { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->previous; \
-                    __nearest_node_index__--; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const typeof(**(__list_ptr__)) *)__node__->element, (__element_ptr__))) { \
+                    __found__ = true; \
+                    break; \
                 } \
+                __node__ = __node__->next; \
             } \
-            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
-                __temp_list__->cached = __nearest_node__->next; \
-                __temp_list__->cached_index = __index__; \
-            } else { \
-                __temp_list__->cached = NULL; \
-            } \
-            if (__nearest_node__->previous != NULL) { \
-                __nearest_node__->previous->next = __nearest_node__->next; \
-            } else { \
-                __temp_list__->head = __nearest_node__->next; \
-            } \
-            if (__nearest_node__->next != NULL) { \
-                __nearest_node__->next->previous = __nearest_node__->previous; \
-            } else { \
-                __temp_list__->tail = __nearest_node__->previous; \
-            } \
-            __temp_list__->length--; \
-            if ((__result_ptr__) != NULL) { \
-                *(__result_ptr__) = *((typeof(**(__list_ptr__)) *)__nearest_node__->element); \
-            } \
-            free(__nearest_node__); \
+            assert(__found__); \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __i__; \
+            *(__result_ptr__) = __i__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Removes the element at the specified index.
+         * Gets the index of the first element that satisfies the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __index__ [size_t] The index to remove the element from.
-         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
+         * @param __element_ptr__ [const T *] A reference to the element to search for.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index of the element.
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the index is out of bounds.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element is not found.
+         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_remove_at(__list_ptr__, __index__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_index_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
-            __Node *__nearest_node__ = NULL; \
-            int __direction__ = 0; \
-            size_t __nearest_node_index__ = 0; \
-            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
-            if (__direction__ == 1) { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->next; \
-                    __nearest_node_index__++; \
-                } \
-            } else { \
-                while (__nearest_node_index__ != __index__) { \
-                    __nearest_node__ = __nearest_node__->previous; \
-                    __nearest_node_index__--; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const __list_element_type__ *)__node__->element, (__element_ptr__))) { \
+                    __found__ = true; \
+                    break; \
                 } \
+                __node__ = __node__->next; \
             } \
-            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
-                __temp_list__->cached = __nearest_node__->next; \
-                __temp_list__->cached_index = __index__; \
-            } else { \
-                __temp_list__->cached = NULL; \
-            } \
-            if (__nearest_node__->previous != NULL) { \
-                __nearest_node__->previous->next = __nearest_node__->next; \
-            } else { \
-                __temp_list__->head = __nearest_node__->next; \
-            } \
-            if (__nearest_node__->next != NULL) { \
-                __nearest_node__->next->previous = __nearest_node__->previous; \
-            } else { \
-                __temp_list__->tail = __nearest_node__->previous; \
-            } \
-            __temp_list__->length--; \
-            if ((__result_ptr__) != NULL) { \
-                *(__result_ptr__) = *((__list_element_type__ *)__nearest_node__->element); \
-            } \
-            free(__nearest_node__); \
+            assert(__found__); \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __i__; \
+            *(__result_ptr__) = __i__; \
         } while(0)
     #endif
 #endif
@@ -1424,98 +1335,56 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Removes the first element that satisfies the boolean comparator.
+         * Counts the elements that satisfy the boolean comparator.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to remove.
+         * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
-         * @return [size_t] The index where the element was removed.
+         * @return [size_t] The count of the elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If the element was not found.
          */
-        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__) ({ \
+        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
             assert(__temp_list__->element_size == sizeof(__element__)); \
             __Node *__node__ = __temp_list__->head; \
-            bool __found__ = false; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __temp_list__->length; __i__++) { \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
                 if ((__boolean_comparator__)(*((typeof(**(__list_ptr__)) *)__node__->element), (__element__))) { \
-                    if (__node__->previous != NULL && __node__->next != NULL) { \
-                        __temp_list__->cached = __node__->next; \
-                        __temp_list__->cached_index = __i__; \
-                    } else { \
-                        __temp_list__->cached = NULL; \
-                    } \
-                    if (__node__->previous != NULL) { \
-                        __node__->previous->next = __node__->next; \
-                    } else { \
-                        __temp_list__->head = __node__->next; \
-                    } \
-                    if (__node__->next != NULL) { \
-                        __node__->next->previous = __node__->previous; \
-                    } else { \
-                        __temp_list__->tail = __node__->previous; \
-                    } \
-                    __temp_list__->length--; \
-                    __found__ = true; \
-                    break; \
+                    __count__++; \
                 } \
                 __node__ = __node__->next; \
             } \
-            assert(__found__); \
-            __i__; \
+            __count__; \
         })
     #else
         /**
          * Public
          * 
-         * Removes the first element that satisfies the boolean comparator.
+         * Counts the elements that satisfy the boolean comparator.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to remove.
+         * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [size_t] The index where the element was removed.
+         * @return [size_t] The count of the elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If the element was not found.
          */
-        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__, __list_element_type__) ({ \
+        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
             assert(__temp_list__->element_size == sizeof(__element__)); \
             __Node *__node__ = __temp_list__->head; \
-            bool __found__ = false; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __temp_list__->length; __i__++) { \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
                 if ((__boolean_comparator__)(*((__list_element_type__ *)__node__->element), (__element__))) { \
-                    if (__node__->previous != NULL && __node__->next != NULL) { \
-                        __temp_list__->cached = __node__->next; \
-                        __temp_list__->cached_index = __i__; \
-                    } else { \
-                        __temp_list__->cached = NULL; \
-                    } \
-                    if (__node__->previous != NULL) { \
-                        __node__->previous->next = __node__->next; \
-                    } else { \
-                        __temp_list__->head = __node__->next; \
-                    } \
-                    if (__node__->next != NULL) { \
-                        __node__->next->previous = __node__->previous; \
-                    } else { \
-                        __temp_list__->tail = __node__->previous; \
-                    } \
-                    __temp_list__->length--; \
-                    __found__ = true; \
-                    break; \
+                    __count__++; \
                 } \
                 __node__ = __node__->next; \
             } \
-            assert(__found__); \
-            __i__; \
+            __count__; \
         })
     #endif
 #else
@@ -1523,190 +1392,121 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Removes the first element that satisfies the boolean comparator.
+         * Counts the elements that satisfy the boolean comparator.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to remove.
+         * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
-         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was removed, if NULL the result will not be stored but the function will execute normally
+         * @param __result_ptr__ [size_t *] A reference to the result.
+         * @return [size_t] The count of the elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If the element was not found.
+         * @throw [assert] If the result reference is NULL.
          */
-        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__) do { \
+        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
             assert(__temp_list__->element_size == sizeof(__element__)); \
             __Node *__node__ = __temp_list__->head; \
-            bool __found__ = false; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __temp_list__->length; __i__++) { \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
                 if ((__boolean_comparator__)(*((typeof(**(__list_ptr__)) *)__node__->element), (__element__))) { \
-                    if (__node__->previous != NULL && __node__->next != NULL) { \
-                        __temp_list__->cached = __node__->next; \
-                        __temp_list__->cached_index = __i__; \
-                    } else { \
-                        __temp_list__->cached = NULL; \
-                    } \
-                    if (__node__->previous != NULL) { \
-                        __node__->previous->next = __node__->next; \
-                    } else { \
-                        __temp_list__->head = __node__->next; \
-                    } \
-                    if (__node__->next != NULL) { \
-                        __node__->next->previous = __node__->previous; \
-                    } else { \
-                        __temp_list__->tail = __node__->previous; \
-                    } \
-                    __temp_list__->length--; \
-                    __found__ = true; \
-                    break; \
+                    __count__++; \
                 } \
                 __node__ = __node__->next; \
             } \
-            assert(__found__); \
-            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __i__; } \
+            *(__result_ptr__) = __count__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Removes the first element that satisfies the boolean comparator.
+         * Counts the elements that satisfy the boolean comparator.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __element__ [T] The element to remove.
+         * @param __element__ [T] The element to search for.
          * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
-         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was removed, if NULL the result will not be stored but the function will execute normally
+         * @param __result_ptr__ [size_t *] A reference to the result.
          * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [size_t] The count of the elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
          * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
-         * @throw [assert] If the element was not found.
+         * @throw [assert] If the result reference is NULL.
          */
-        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_count(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
             assert(__temp_list__->element_size == sizeof(__element__)); \
             __Node *__node__ = __temp_list__->head; \
-            bool __found__ = false; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __temp_list__->length; __i__++) { \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
                 if ((__boolean_comparator__)(*((__list_element_type__ *)__node__->element), (__element__))) { \
-                    if (__node__->previous != NULL && __node__->next != NULL) { \
-                        __temp_list__->cached = __node__->next; \
-                        __temp_list__->cached_index = __i__; \
-                    } else { \
-                        __temp_list__->cached = NULL; \
-                    } \
-                    if (__node__->previous != NULL) { \
-                        __node__->previous->next = __node__->next; \
-                    } else { \
-                        __temp_list__->head = __node__->next; \
-                    } \
-                    if (__node__->next != NULL) { \
-                        __node__->next->previous = __node__->previous; \
-                    } else { \
-                        __temp_list__->tail = __node__->previous; \
-                    } \
-                    __temp_list__->length--; \
-                    __found__ = true; \
-                    break; \
+                    __count__++; \
                 } \
                 __node__ = __node__->next; \
             } \
-            assert(__found__); \
-            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __i__; } \
+            *(__result_ptr__) = __count__; \
         } while(0)
     #endif
 #endif
 
-/**
- * Public
- * 
- * Clears the list.
- * @param __list_ptr__ [T **] A reference to the list.
- * @throw [assert] If the reference to the list is NULL.
- * @throw [assert] If the list is NULL.
- */
-#define LinkedList_clear(__list_ptr__) do { \
-    assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-    LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-    __Node *__current_node__ = __temp_list__->head; \
-    while (__current_node__ != NULL) { \
-        __Node *__next_node__ = __current_node__->next; \
-        free(__current_node__); \
-        __current_node__ = __next_node__; \
-    } \
-    __temp_list__->head = NULL; \
-    __temp_list__->tail = NULL; \
-    __temp_list__->cached = NULL; \
-    __temp_list__->length = 0; \
-} while(0)
-
 #if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
     #if COMPILER_SUPPORTS_TYPEOF
         /**
          * Public
          * 
-         * Copies the list.
+         * Counts the elements that satisfy the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @return [T *] The copied list.
+         * @param __element_ptr__ [const T *] A reference to the element to count.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
+         * @return [size_t] The number of elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          */
-        #define LinkedList_copy(__list_ptr__) ({ \
+        #define LinkedList_count_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const typeof(**(__list_ptr__)) *)__node__->element, (__element_ptr__))) { \
+                    __count__++; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
+                __node__ = __node__->next; \
             } \
-            __new_list__; \
+            __count__; \
         })
     #else
         /**
          * Public
          * 
-         * Copies the list.
+         * Counts the elements that satisfy the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
+         * @param __element_ptr__ [const T *] A reference to the element to count.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [T *] The copied list.
+         * @return [size_t] The number of elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          */
-        #define LinkedList_copy(__list_ptr__, __list_element_type__) ({ \
+        #define LinkedList_count_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const __list_element_type__ *)__node__->element, (__element_ptr__))) { \
+                    __count__++; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
+                __node__ = __node__->next; \
             } \
-            __new_list__; \
+            __count__; \
         })
     #endif
 #else
@@ -1714,439 +1514,384 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Copies the list.
+         * Counts the elements that satisfy the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __result_ptr__ [T **] A reference to the variable to store the copied list.
+         * @param __element_ptr__ [const T *] A reference to the element to count.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of elements.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_copy(__list_ptr__, __result_ptr__) do { \
+        #define LinkedList_count_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const typeof(**(__list_ptr__)) *)__node__->element, (__element_ptr__))) { \
+                    __count__++; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
+                __node__ = __node__->next; \
             } \
-            *(__result_ptr__) = __new_list__; \
+            *(__result_ptr__) = __count__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Copies the list.
+         * Counts the elements that satisfy the boolean comparator, which receives references to the elements.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __result_ptr__ [T **] A reference to the variable to store the copied list.
+         * @param __element_ptr__ [const T *] A reference to the element to count.
+         * @param __boolean_comparator__ [bool (*)(const T *, const T *)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of elements.
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_copy(__list_ptr__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_count_by_ref(__list_ptr__, __element_ptr__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __temp_list__->head; \
+            size_t __count__ = 0; \
+            for (size_t __i__ = 0; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)((const __list_element_type__ *)__node__->element, (__element_ptr__))) { \
+                    __count__++; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
+                __node__ = __node__->next; \
             } \
-            *(__result_ptr__) = __new_list__; \
+            *(__result_ptr__) = __count__; \
         } while(0)
     #endif
 #endif
 
-/**
- * Public
- * 
- * Reverses the list in place.
- * @param __list_ptr__ [T **] A reference to the list.
- * @throw [assert] If the reference to the list is NULL.
- * @throw [assert] If the list is NULL.
- * TODO: this function errors if the list is empty, check it out
- */
-#define LinkedList_reverse(__list_ptr__) do { \
-    assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-    LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-    __Node *__current_node__ = __temp_list__->head; \
-    while (__current_node__ != NULL) { \
-        __Node *__next_node__ = __current_node__->next; \
-        __current_node__->next = __current_node__->previous; \
-        __current_node__->previous = __next_node__; \
-        __current_node__ = __next_node__; \
-    } \
-    __Node *__temp_node__ = __temp_list__->head; \
-    __temp_list__->head = __temp_list__->tail; \
-    __temp_list__->tail = __temp_node__; \
-    __temp_list__->cached_index = __temp_list__->length - 1 - __temp_list__->cached_index; \
-} while(0)
-
-#define __LinkedList_merge__(__left_list_reference__, __right_list_reference__, __head_result_reference__, __tail_result_reference__, __ordering_comparator__, __list_element_type__) do { \
-    if ((*(__left_list_reference__)) == NULL) { \
-        *(__head_result_reference__) = (*(__right_list_reference__)); \
-    } else if ((*(__right_list_reference__)) == NULL) { \
-        *(__head_result_reference__) = (*(__left_list_reference__)); \
-    } else { \
-        __Node *__current_left__  = (*(__left_list_reference__)); \
-        __Node *__current_right__ = (*(__right_list_reference__)); \
-        __list_element_type__ __left_value__  = *((__list_element_type__ *)__current_left__->element); \
-        __list_element_type__ __right_value__ = *((__list_element_type__ *)__current_right__->element); \
-        if ((__ordering_comparator__)(__left_value__, __right_value__) <= 0) { \
-            *(__head_result_reference__)       = __current_left__; \
-            __current_left__ = __current_left__->next; \
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Pushes an element to the end of the list.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __element__ [T] The element to push.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_push(__list_ptr__, __element__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        assert(__temp_list__->element_size == sizeof(__element__)); \
+        __Node *__node__ = __node_init(__temp_list__->element_size); \
+        __node__->previous = __temp_list__->tail; \
+        *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
+        if (__temp_list__->head == NULL) { \
+            __temp_list__->head = __node__; \
         } else { \
-            *(__head_result_reference__)        = __current_right__; \
-            __current_right__ = __current_right__->next; \
+            __temp_list__->tail->next = __node__; \
         } \
-        __Node *__current_result__ = *(__head_result_reference__); \
-        while (__current_left__ != NULL && __current_right__ != NULL) { \
-            __left_value__  = *((__list_element_type__ *)__current_left__->element); \
-            __right_value__ = *((__list_element_type__ *)__current_right__->element); \
-            if ((__ordering_comparator__)(__left_value__, __right_value__) <= 0) { \
-                __current_result__->next   = __current_left__; \
-                __current_left__->previous = __current_result__; \
-                __current_left__           = __current_left__->next; \
-            } else { \
-                __current_result__->next    = __current_right__; \
-                __current_right__->previous = __current_result__; \
-                __current_right__           = __current_right__->next; \
-            } \
-            __current_result__ = __current_result__->next; \
+        __temp_list__->tail = __node__; \
+        __temp_list__->length++; \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Pushes an element to the end of the list.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __element__ [T] The element to push.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_push(__list_ptr__, __element__, __list_element_type__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        assert(__temp_list__->element_size == sizeof(__element__)); \
+        __Node *__node__ = __node_init(__temp_list__->element_size); \
+        __node__->previous = __temp_list__->tail; \
+        *((__list_element_type__ *)__node__->element) = (__element__); \
+        if (__temp_list__->head == NULL) { \
+            __temp_list__->head = __node__; \
+        } else { \
+            __temp_list__->tail->next = __node__; \
         } \
-        if (__current_left__ == NULL) { \
-            __current_result__->next    = __current_right__; \
-            __current_right__->previous = __current_result__; \
+        __temp_list__->tail = __node__; \
+        __temp_list__->length++; \
+    } while(0)
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Pushes an element to the front of the list in O(1), the cached node stays cached.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __element__ [T] The element to push.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_push_front(__list_ptr__, __element__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        assert(__temp_list__->element_size == sizeof(__element__)); \
+        __Node *__node__ = __node_init(__temp_list__->element_size); \
+        __node__->next = __temp_list__->head; \
+        *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
+        if (__temp_list__->head == NULL) { \
+            __temp_list__->tail = __node__; \
+        } else { \
+            __temp_list__->head->previous = __node__; \
         } \
-        else { \
-            __current_result__->next   = __current_left__; \
-            __current_left__->previous = __current_result__; \
+        __temp_list__->head = __node__; \
+        if (__temp_list__->cached != NULL) { \
+            __temp_list__->cached_index++; \
         } \
-        /* make __current_result__ point to the tail */ \
-        while (__current_result__->next != NULL) { \
-            __current_result__ = __current_result__->next; \
+        __temp_list__->length++; \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Pushes an element to the front of the list in O(1), the cached node stays cached.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __element__ [T] The element to push.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_push_front(__list_ptr__, __element__, __list_element_type__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        assert(__temp_list__->element_size == sizeof(__element__)); \
+        __Node *__node__ = __node_init(__temp_list__->element_size); \
+        __node__->next = __temp_list__->head; \
+        *((__list_element_type__ *)__node__->element) = (__element__); \
+        if (__temp_list__->head == NULL) { \
+            __temp_list__->tail = __node__; \
+        } else { \
+            __temp_list__->head->previous = __node__; \
         } \
-        *(__tail_result_reference__) = __current_result__; \
-    } \
-} while (0)
-
-#define __LinkedList_split__(__head_node_reference__, __second_list_reference__, __size__) do { \
-    __Node *__first__  = *(__head_node_reference__); \
-    __Node *__second__ = __first__; \
-    for (int i = 1; __first__ != NULL && i < (__size__); i++) { \
-        __first__ = __first__->next; \
-    } \
-    if (__first__ == NULL) { \
-        __second__ = NULL; \
-    } else { \
-        __second__ = __first__->next; \
-        if (__second__ != NULL) { \
-            __second__->previous = NULL; \
+        __temp_list__->head = __node__; \
+        if (__temp_list__->cached != NULL) { \
+            __temp_list__->cached_index++; \
         } \
-        __first__->next = NULL; \
-    } \
-    (*(__second_list_reference__)) = __second__; \
-} while (0)
+        __temp_list__->length++; \
+    } while(0)
+#endif
 
 #if COMPILER_SUPPORTS_TYPEOF
     /**
      * Public
      * 
-     * Sorts the list in place.
+     * Inserts an element at the specified index.
      * @param __list_ptr__ [T **] A reference to the list.
-     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+     * @param __index__ [size_t] The index to insert the element at.
+     * @param __element__ [T] The element to insert.
      * @throw [assert] If the reference to the list is NULL.
      * @throw [assert] If the list is NULL.
+     * @throw [assert] If the index is out of bounds.
+     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+     * @throw [assert] If malloc fails.
      */
-    #define LinkedList_sort(__list_ptr__, __ordering_comparator__) do { \
-        assert((__list_ptr__) != NULL && (*(__list_ptr__) != NULL)); \
+    #define LinkedList_insert_at(__list_ptr__, __index__, __element__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
         LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        /* if list contains 0 or 1 element do nothing */ \
-        if ((__temp_list__)->head != NULL && (__temp_list__)->head->next != NULL) { \
-            for (size_t __size__ = 1; __size__ < __temp_list__->length; __size__ *= 2) { \
-                __Node *__curr__ = (__temp_list__)->head; /* points at the first element of the list to be splitted and remerged */ \
-                __Node *__sorted_head__ = NULL; /* points at the first node of the subsorted list */ \
-                __Node *__sorted_tail__ = NULL; /* points at the last  node of the subsorted list */ \
-                while (__curr__ != NULL) { \
-                    __Node *__left_sublist__  = __curr__; \
-                    __Node *__right_sublist__;\
-                    __LinkedList_split__(&__left_sublist__ , &__right_sublist__, __size__); \
-                    __LinkedList_split__(&__right_sublist__, &__curr__, __size__); \
-                    __Node *__merged_list_head__, *__merged_list_tail__; \
-                    __LinkedList_merge__(&__left_sublist__, &__right_sublist__, &__merged_list_head__, &__merged_list_tail__, (__ordering_comparator__), typeof(**(__list_ptr__))); \
-                    if (__sorted_head__ == NULL) { \
-                        __sorted_head__ = __merged_list_head__; \
-                    } else { \
-                        __sorted_tail__->next = __merged_list_head__; \
-                        __merged_list_head__->previous = __sorted_tail__; \
-                    } \
-                    __sorted_tail__ = __merged_list_tail__; \
+        __linkedlist_detach(__temp_list__); \
+        assert((__index__ >= 0) && (__index__ <= __temp_list__->length)); \
+        assert(__temp_list__->element_size == sizeof(__element__)); \
+        __Node *__node__ = __node_init(__temp_list__->element_size); \
+        *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
+        if (__index__ == 0) { \
+            __node__->next = __temp_list__->head; \
+            if (__temp_list__->head) { \
+                __temp_list__->head->previous = __node__; \
+            } \
+            __temp_list__->head = __node__; \
+            if (!__temp_list__->tail) { \
+                __temp_list__->tail = __node__; \
+            } \
+            __temp_list__->cached_index++; \
+        } else if (__index__ == __temp_list__->length) { \
+            __node__->previous = __temp_list__->tail; \
+            if (__temp_list__->tail) { \
+                __temp_list__->tail->next = __node__; \
+            } \
+            __temp_list__->tail = __node__; \
+            if (!__temp_list__->head) { \
+                __temp_list__->head = __node__; \
+            } \
+        } else { \
+            __Node *__nearest_node__ = NULL; \
+            int __direction__ = 0; \
+            size_t __nearest_node_index__ = 0; \
+            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
+            if (__direction__ == 1) { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->next; \
+                    __nearest_node_index__++; \
+                } \
+            } else { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->previous; \
+                    __nearest_node_index__--; \
                 } \
-                (__temp_list__)->head = __sorted_head__; \
-                (__temp_list__)->tail = __sorted_tail__; \
             } \
+            __node__->next = __nearest_node__; \
+            __node__->previous = __nearest_node__->previous; \
+            if (__nearest_node__->previous) { \
+                __nearest_node__->previous->next = __node__; \
+            } \
+            __nearest_node__->previous = __node__; \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __index__; \
         } \
-        __temp_list__->cached = NULL; \
-    } while (0)
+        __temp_list__->length++; \
+    } while(0)
+
 #else
     /**
      * Public
      * 
-     * Sorts the list in place.
+     * Inserts an element at the specified index.
      * @param __list_ptr__ [T **] A reference to the list.
-     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+     * @param __index__ [size_t] The index to insert the element at.
+     * @param __element__ [T] The element to insert.
      * @param __list_element_type__ [type] The type of the elements in the list.
      * @throw [assert] If the reference to the list is NULL.
      * @throw [assert] If the list is NULL.
+     * @throw [assert] If the index is out of bounds.
+     * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+     * @throw [assert] If malloc fails.
      */
-    #define LinkedList_sort(__list_ptr__, __ordering_comparator__, __list_element_type__) do { \
-        assert((__list_ptr__) != NULL && (*(__list_ptr__) != NULL)); \
+    #define LinkedList_insert_at(__list_ptr__, __index__, __element__, __list_element_type__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
         LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        /* if list contains 0 or 1 element do nothing */ \
-        if ((__temp_list__)->head != NULL && (__temp_list__)->head->next != NULL) { \
-            for (size_t __size__ = 1; __size__ < __temp_list__->length; __size__ *= 2) { \
-                __Node *__curr__ = (__temp_list__)->head; /* points at the first element of the list to be splitted and remerged */ \
-                __Node *__sorted_head__ = NULL; /* points at the first node of the subsorted list */ \
-                __Node *__sorted_tail__ = NULL; /* points at the last  node of the subsorted list */ \
-                while (__curr__ != NULL) { \
-                    __Node *__left_sublist__  = __curr__; \
-                    __Node *__right_sublist__;\
-                    __LinkedList_split__(&__left_sublist__ , &__right_sublist__, __size__); \
-                    __LinkedList_split__(&__right_sublist__, &__curr__, __size__); \
-                    __Node *__merged_list_head__, *__merged_list_tail__; \
-                    __LinkedList_merge__(&__left_sublist__, &__right_sublist__, &__merged_list_head__, &__merged_list_tail__, (__ordering_comparator__), __list_element_type__); \
-                    if (__sorted_head__ == NULL) { \
-                        __sorted_head__ = __merged_list_head__; \
-                    } else { \
-                        __sorted_tail__->next = __merged_list_head__; \
-                        __merged_list_head__->previous = __sorted_tail__; \
-                    } \
-                    __sorted_tail__ = __merged_list_tail__; \
-                } \
-                (__temp_list__)->head = __sorted_head__; \
-                (__temp_list__)->tail = __sorted_tail__; \
+        __linkedlist_detach(__temp_list__); \
+        assert((__index__ >= 0) && (__index__ <= __temp_list__->length)); \
+        assert(__temp_list__->element_size == sizeof(__element__)); \
+        __Node *__node__ = __node_init(__temp_list__->element_size); \
+        *((__list_element_type__ *)__node__->element) = (__element__); \
+        if (__index__ == 0) { \
+            __node__->next = __temp_list__->head; \
+            if (__temp_list__->head) { \
+                __temp_list__->head->previous = __node__; \
             } \
-        } \
-        __temp_list__->cached = NULL; \
-    } while (0)
-#endif
-
-#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
-    #if COMPILER_SUPPORTS_TYPEOF
-        /**
-         * Public
-         * 
-         * Filters the list.
-         * @param __list_ptr__ [T **] A reference to the list.
-         * @param __filter__ [bool (*)(T)] The filter.
-         * @return [T *] The filtered list.
-         * @throw [assert] If the reference to the list is NULL.
-         * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
-         */
-        #define LinkedList_filter(__list_ptr__, __filter__) ({ \
-            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                if ((__filter__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
-                    __Node *__node__ = __node_init(__temp_list__->element_size); \
-                    *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
-                    if (__temp_new_list__->head == NULL) { \
-                        __temp_new_list__->head = __node__; \
-                    } else { \
-                        __temp_new_list__->tail->next = __node__; \
-                        __node__->previous = __temp_new_list__->tail; \
-                    } \
-                    __temp_new_list__->tail = __node__; \
-                    __temp_new_list__->length++; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __temp_list__->head = __node__; \
+            if (!__temp_list__->tail) { \
+                __temp_list__->tail = __node__; \
             } \
-            __new_list__; \
-        })
-    #else
-        /**
-         * Public
-         * 
-         * Filters the list.
-         * @param __list_ptr__ [T **] A reference to the list.
-         * @param __filter__ [bool (*)(T)] The filter.
-         * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [T *] The filtered list.
-         * @throw [assert] If the reference to the list is NULL.
-         * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
-         */
-        #define LinkedList_filter(__list_ptr__, __filter__, __list_element_type__) ({ \
-            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                if ((__filter__)(*((__list_element_type__ *)__current_node__->element))) { \
-                    __Node *__node__ = __node_init(__temp_list__->element_size); \
-                    *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
-                    if (__temp_new_list__->head == NULL) { \
-                        __temp_new_list__->head = __node__; \
-                    } else { \
-                        __temp_new_list__->tail->next = __node__; \
-                        __node__->previous = __temp_new_list__->tail; \
-                    } \
-                    __temp_new_list__->tail = __node__; \
-                    __temp_new_list__->length++; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __temp_list__->cached_index++; \
+        } else if (__index__ == __temp_list__->length) { \
+            __node__->previous = __temp_list__->tail; \
+            if (__temp_list__->tail) { \
+                __temp_list__->tail->next = __node__; \
             } \
-            __new_list__; \
-        })
-    #endif
-#else
-    #if COMPILER_SUPPORTS_TYPEOF
-        /**
-         * Public
-         * 
-         * Filters the list.
-         * @param __list_ptr__ [T **] A reference to the list.
-         * @param __filter__ [bool (*)(T)] The filter.
-         * @param __result_ptr__ [T **] A reference to the variable to store the filtered list.
-         * @throw [assert] If the reference to the list is NULL.
-         * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
-         * @throw [assert] If the result pointer is NULL.
-         */
-        #define LinkedList_filter(__list_ptr__, __filter__, __result_ptr__) do { \
-            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                if ((__filter__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
-                    __Node *__node__ = __node_init(__temp_list__->element_size); \
-                    *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
-                    if (__temp_new_list__->head == NULL) { \
-                        __temp_new_list__->head = __node__; \
-                    } else { \
-                        __temp_new_list__->tail->next = __node__; \
-                        __node__->previous = __temp_new_list__->tail; \
-                    } \
-                    __temp_new_list__->tail = __node__; \
-                    __temp_new_list__->length++; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __temp_list__->tail = __node__; \
+            if (!__temp_list__->head) { \
+                __temp_list__->head = __node__; \
             } \
-            *(__result_ptr__) = __new_list__; \
-        } while(0)
-    #else
-        /**
-         * Public
-         * 
-         * Filters the list.
-         * @param __list_ptr__ [T **] A reference to the list.
-         * @param __filter__ [bool (*)(T)] The filter.
-         * @param __result_ptr__ [T **] A reference to the variable to store the filtered list.
-         * @param __list_element_type__ [type] The type of the elements in the list.
-         * @throw [assert] If the reference to the list is NULL.
-         * @throw [assert] If the list is NULL.
-         * @throw [assert] If malloc fails.
-         * @throw [assert] If the result pointer is NULL.
-         */
-        #define LinkedList_filter(__list_ptr__, __filter__, __result_ptr__, __list_element_type__) do { \
-            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
-            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                if ((__filter__)(*((__list_element_type__ *)__current_node__->element))) { \
-                    __Node *__node__ = __node_init(__temp_list__->element_size); \
-                    *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
-                    if (__temp_new_list__->head == NULL) { \
-                        __temp_new_list__->head = __node__; \
-                    } else { \
-                        __temp_new_list__->tail->next = __node__; \
-                        __node__->previous = __temp_new_list__->tail; \
-                    } \
-                    __temp_new_list__->tail = __node__; \
-                    __temp_new_list__->length++; \
+        } else { \
+            __Node *__nearest_node__ = NULL; \
+            int __direction__ = 0; \
+            size_t __nearest_node_index__ = 0; \
+            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
+            if (__direction__ == 1) { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->next; \
+                    __nearest_node_index__++; \
+                } \
+            } else { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->previous; \
+                    __nearest_node_index__--; \
                 } \
-                __current_node__ = __current_node__->next; \
             } \
-            *(__result_ptr__) = __new_list__; \
-        } while(0)
-    #endif
+            __node__->next = __nearest_node__; \
+            __node__->previous = __nearest_node__->previous; \
+            if (__nearest_node__->previous) { \
+                __nearest_node__->previous->next = __node__; \
+            } \
+            __nearest_node__->previous = __node__; \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __index__; \
+        } \
+        __temp_list__->length++; \
+    } while(0)
 #endif
 
 #if COMPILER_SUPPORTS_TYPEOF
     /**
      * Public
      * 
-     * Executes a function for each element in the list.
+     * Pushes a node with an uninitialized element to the end of the list, so the element can be built directly inside the list.
      * @param __list_ptr__ [T **] A reference to the list.
-     * @param __func__ [void (*)(T)] The function to execute.
+     * @return [T *] A reference to the uninitialized element, valid until its node is removed.
      * @throw [assert] If the reference to the list is NULL.
      * @throw [assert] If the list is NULL.
+     * @throw [assert] If malloc fails.
      */
-    #define LinkedList_foreach(__list_ptr__, __func__) do { \
-        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        __Node *__current_node__ = __temp_list__->head; \
-        while (__current_node__ != NULL) { \
-            (__func__)((typeof(**(__list_ptr__)) *)__current_node__->element); \
-            __current_node__ = __current_node__->next; \
-        } \
-    } while(0)
+    #define LinkedList_emplace_back(__list_ptr__) ((typeof(**(__list_ptr__)) *)__linkedlist_emplace_at((__list_ptr__), LinkedList_length(__list_ptr__)))
 #else
     /**
      * Public
      * 
-     * Executes a function for each element in the list.
+     * Pushes a node with an uninitialized element to the end of the list, so the element can be built directly inside the list.
      * @param __list_ptr__ [T **] A reference to the list.
-     * @param __func__ [void (*)(T)] The function to execute.
      * @param __list_element_type__ [type] The type of the elements in the list.
+     * @return [T *] A reference to the uninitialized element, valid until its node is removed.
      * @throw [assert] If the reference to the list is NULL.
      * @throw [assert] If the list is NULL.
+     * @throw [assert] If malloc fails.
      */
-    #define LinkedList_foreach(__list_ptr__, __func__, __list_element_type__) do { \
-        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-        __Node *__current_node__ = __temp_list__->head; \
-        while (__current_node__ != NULL) { \
-            (__func__)((__list_element_type__ *)__current_node__->element); \
-            __current_node__ = __current_node__->next; \
-        } \
-    } while(0)
+    #define LinkedList_emplace_back(__list_ptr__, __list_element_type__) ((__list_element_type__ *)__linkedlist_emplace_at((__list_ptr__), LinkedList_length(__list_ptr__)))
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Inserts a node with an uninitialized element at the specified index, so the element can be built directly inside the list.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __index__ [size_t] The index to insert the element at.
+     * @return [T *] A reference to the uninitialized element, valid until its node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the index is out of bounds.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_emplace_at(__list_ptr__, __index__) ((typeof(**(__list_ptr__)) *)__linkedlist_emplace_at((__list_ptr__), (__index__)))
+#else
+    /**
+     * Public
+     * 
+     * Inserts a node with an uninitialized element at the specified index, so the element can be built directly inside the list.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __index__ [size_t] The index to insert the element at.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @return [T *] A reference to the uninitialized element, valid until its node is removed.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If the index is out of bounds.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_emplace_at(__list_ptr__, __index__, __list_element_type__) ((__list_element_type__ *)__linkedlist_emplace_at((__list_ptr__), (__index__)))
 #endif
 
 #if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
@@ -2154,68 +1899,108 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Maps the list.
+         * Inserts an element at the correct position given an ordered list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __mapper__ [U (*)(T)] The mapper.
-         * @return [U *] The mapped list.
+         * @param __element__ [T] The element to insert.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @return [size_t] The index where the element was inserted.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          * @throw [assert] If malloc fails.
          */
-        #define LinkedList_map(__list_ptr__, __mapper__) ({ \
+        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((typeof(**(__list_ptr__)) *)__node__->element) = (__mapper__)(*((typeof(**(__list_ptr__)) *)__current_node__->element)); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
+            size_t __insert_index__ = 0; \
+            if (__temp_list__->head == NULL) { \
+                __temp_list__->head = __node__; \
+                __temp_list__->tail = __node__; \
+            } else { \
+                __Node *__current_node__ = __temp_list__->head; \
+                while (__current_node__ != NULL) { \
+                    if ((__ordering_comparator__)(*((typeof(**(__list_ptr__)) *)__current_node__->element), (__element__)) >= 0) { \
+                        if (__current_node__->previous != NULL) { \
+                            __current_node__->previous->next = __node__; \
+                            __node__->previous = __current_node__->previous; \
+                        } else { \
+                            __temp_list__->head = __node__; \
+                        } \
+                        __node__->next = __current_node__; \
+                        __current_node__->previous = __node__; \
+                        break; \
+                        __temp_list__->cached = __node__; \
+                        __temp_list__->cached_index = __insert_index__; \
+                    } \
+                    __current_node__ = __current_node__->next; \
+                    __insert_index__++; \
+                } \
+                if (__current_node__ == NULL) { \
+                    __temp_list__->tail->next = __node__; \
+                    __node__->previous = __temp_list__->tail; \
+                    __temp_list__->tail = __node__; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
             } \
-            __new_list__; \
+            __temp_list__->length++; \
+            __insert_index__; \
         })
     #else
         /**
          * Public
          * 
-         * Maps the list.
+         * Inserts an element at the correct position given an ordered list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __mapper__ [U (*)(T)] The mapper.
+         * @param __element__ [T] The element to insert.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [U *] The mapped list.
+         * @return [size_t] The index where the element was inserted.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          * @throw [assert] If malloc fails.
          */
-        #define LinkedList_map(__list_ptr__, __mapper__, __list_element_type__) ({ \
+        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((__list_element_type__ *)__node__->element) = (__mapper__)(*((__list_element_type__ *)__current_node__->element)); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((__list_element_type__ *)__node__->element) = (__element__); \
+            size_t __insert_index__ = 0; \
+            if (__temp_list__->head == NULL) { \
+                __temp_list__->head = __node__; \
+                __temp_list__->tail = __node__; \
+            } else { \
+                __Node *__current_node__ = __temp_list__->head; \
+                while (__current_node__ != NULL) { \
+                    if ((__ordering_comparator__)(*((__list_element_type__ *)__current_node__->element), (__element__)) >= 0) { \
+                        if (__current_node__->previous != NULL) { \
+                            __current_node__->previous->next = __node__; \
+                            __node__->previous = __current_node__->previous; \
+                        } else { \
+                            __temp_list__->head = __node__; \
+                        } \
+                        __node__->next = __current_node__; \
+                        __current_node__->previous = __node__; \
+                        break; \
+                        __temp_list__->cached = __node__; \
+                        __temp_list__->cached_index = __insert_index__; \
+                    } \
+                    __current_node__ = __current_node__->next; \
+                    __insert_index__++; \
+                } \
+                if (__current_node__ == NULL) { \
+                    __temp_list__->tail->next = __node__; \
+                    __node__->previous = __temp_list__->tail; \
+                    __temp_list__->tail = __node__; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
             } \
-            __new_list__; \
+            __temp_list__->length++; \
+            __insert_index__; \
         })
     #endif
 #else
@@ -2223,72 +2008,108 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Maps the list.
+         * Inserts an element at the correct position given an ordered list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __mapper__ [U (*)(T)] The mapper.
-         * @param __result_ptr__ [T **] A reference to the variable to store the mapped list.
+         * @param __element__ [T] The element to insert.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was inserted, if NULL the result will not be stored but the function will execute normally
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          * @throw [assert] If malloc fails.
-         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_map(__list_ptr__, __mapper__, __result_ptr__) do { \
+        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((typeof(**(__list_ptr__)) *)__node__->element) = (__mapper__)(*((typeof(**(__list_ptr__)) *)__current_node__->element)); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((typeof(**(__list_ptr__)) *)__node__->element) = (__element__); \
+            size_t __insert_index__ = 0; \
+            if (__temp_list__->head == NULL) { \
+                __temp_list__->head = __node__; \
+                __temp_list__->tail = __node__; \
+            } else { \
+                __Node *__current_node__ = __temp_list__->head; \
+                while (__current_node__ != NULL) { \
+                    if ((__ordering_comparator__)(*((typeof(**(__list_ptr__)) *)__current_node__->element), (__element__)) >= 0) { \
+                        if (__current_node__->previous != NULL) { \
+                            __current_node__->previous->next = __node__; \
+                            __node__->previous = __current_node__->previous; \
+                        } else { \
+                            __temp_list__->head = __node__; \
+                        } \
+                        __node__->next = __current_node__; \
+                        __current_node__->previous = __node__; \
+                        break; \
+                        __temp_list__->cached = __node__; \
+                        __temp_list__->cached_index = __insert_index__; \
+                    } \
+                    __current_node__ = __current_node__->next; \
+                    __insert_index__++; \
+                } \
+                if (__current_node__ == NULL) { \
+                    __temp_list__->tail->next = __node__; \
+                    __node__->previous = __temp_list__->tail; \
+                    __temp_list__->tail = __node__; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
             } \
-            *(__result_ptr__) = __new_list__; \
+            __temp_list__->length++; \
+            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __insert_index__; } \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Maps the list.
+         * Inserts an element at the correct position given an ordered list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __mapper__ [U (*)(T)] The mapper.
-         * @param __result_ptr__ [T **] A reference to the variable to store the mapped list.
+         * @param __element__ [T] The element to insert.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was inserted, if NULL the result will not be stored but the function will execute normally
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
          * @throw [assert] If malloc fails.
-         * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_map(__list_ptr__, __mapper__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_insert_sorted(__list_ptr__, __element__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((__list_element_type__ *)__node__->element) = (__mapper__)(*((__list_element_type__ *)__current_node__->element)); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((__list_element_type__ *)__node__->element) = (__element__); \
+            size_t __insert_index__ = 0; \
+            if (__temp_list__->head == NULL) { \
+                __temp_list__->head = __node__; \
+                __temp_list__->tail = __node__; \
+            } else { \
+                __Node *__current_node__ = __temp_list__->head; \
+                while (__current_node__ != NULL) { \
+                    if ((__ordering_comparator__)(*((__list_element_type__ *)__current_node__->element), (__element__)) >= 0) { \
+                        if (__current_node__->previous != NULL) { \
+                            __current_node__->previous->next = __node__; \
+                            __node__->previous = __current_node__->previous; \
+                        } else { \
+                            __temp_list__->head = __node__; \
+                        } \
+                        __node__->next = __current_node__; \
+                        __current_node__->previous = __node__; \
+                        break; \
+                        __temp_list__->cached = __node__; \
+                        __temp_list__->cached_index = __insert_index__; \
+                    } \
+                    __current_node__ = __current_node__->next; \
+                    __insert_index__++; \
+                } \
+                if (__current_node__ == NULL) { \
+                    __temp_list__->tail->next = __node__; \
+                    __node__->previous = __temp_list__->tail; \
+                    __temp_list__->tail = __node__; \
                 } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                __current_node__ = __current_node__->next; \
             } \
-            *(__result_ptr__) = __new_list__; \
+            __temp_list__->length++; \
+            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __insert_index__; } \
         } while(0)
     #endif
 #endif
@@ -2298,48 +2119,94 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Reduces the list to a single value.
+         * Inserts an element at the correct position given an ordered list, the comparator receives references to the elements.
+         * The element is copied once, into its node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __reducer__ [U (*)(U, T)] The reducer.
-         * @param __initial_value__ [U] The initial value.
-         * @return [U] The reduced value.
+         * @param __element_ptr__ [const T *] A reference to the element to insert.
+         * @param __ordering_comparator__ [int (*)(const T *, const T *)] The ordering comparator.
+         * @return [size_t] The index where the element was inserted.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If malloc fails.
          */
-        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__) ({ \
+        #define LinkedList_insert_sorted_by_ref(__list_ptr__, __element_ptr__, __ordering_comparator__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(__initial_value__) __accumulator__ = (__initial_value__); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((typeof(**(__list_ptr__)) *)__node__->element) = *(__element_ptr__); \
             __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __accumulator__ = (__reducer__)(__accumulator__, *((typeof(**(__list_ptr__)) *)__current_node__->element)); \
+            size_t __insert_index__ = 0; \
+            while (__current_node__ != NULL && __LinkedList_compare_refs__(__ordering_comparator__, typeof(**(__list_ptr__)), __current_node__, __node__) < 0) { \
                 __current_node__ = __current_node__->next; \
+                __insert_index__++; \
             } \
-            __accumulator__; \
+            __node__->next = __current_node__; \
+            if (__current_node__ != NULL) { \
+                __node__->previous = __current_node__->previous; \
+                __current_node__->previous = __node__; \
+            } else { \
+                __node__->previous = __temp_list__->tail; \
+                __temp_list__->tail = __node__; \
+            } \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = __node__; \
+            } else { \
+                __temp_list__->head = __node__; \
+            } \
+            __temp_list__->length++; \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __insert_index__; \
+            __insert_index__; \
         })
     #else
         /**
          * Public
          * 
-         * Reduces the list to a single value.
+         * Inserts an element at the correct position given an ordered list, the comparator receives references to the elements.
+         * The element is copied once, into its node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __reducer__ [U (*)(U, T)] The reducer.
-         * @param __initial_value__ [U] The initial value.
+         * @param __element_ptr__ [const T *] A reference to the element to insert.
+         * @param __ordering_comparator__ [int (*)(const T *, const T *)] The ordering comparator.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [U] The reduced value.
+         * @return [size_t] The index where the element was inserted.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If malloc fails.
          */
-        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__, __list_element_type__) ({ \
+        #define LinkedList_insert_sorted_by_ref(__list_ptr__, __element_ptr__, __ordering_comparator__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ __accumulator__ = (__initial_value__); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((__list_element_type__ *)__node__->element) = *(__element_ptr__); \
             __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __accumulator__ = (__reducer__)(__accumulator__, *((__list_element_type__ *)__current_node__->element)); \
+            size_t __insert_index__ = 0; \
+            while (__current_node__ != NULL && __LinkedList_compare_refs__(__ordering_comparator__, __list_element_type__, __current_node__, __node__) < 0) { \
                 __current_node__ = __current_node__->next; \
+                __insert_index__++; \
             } \
-            __accumulator__; \
+            __node__->next = __current_node__; \
+            if (__current_node__ != NULL) { \
+                __node__->previous = __current_node__->previous; \
+                __current_node__->previous = __node__; \
+            } else { \
+                __node__->previous = __temp_list__->tail; \
+                __temp_list__->tail = __node__; \
+            } \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = __node__; \
+            } else { \
+                __temp_list__->head = __node__; \
+            } \
+            __temp_list__->length++; \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __insert_index__; \
+            __insert_index__; \
         })
     #endif
 #else
@@ -2347,107 +2214,205 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Reduces the list to a single value.
+         * Inserts an element at the correct position given an ordered list, the comparator receives references to the elements.
+         * The element is copied once, into its node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __reducer__ [U (*)(U, T)] The reducer.
-         * @param __initial_value__ [U] The initial value.
-         * @param __result_ptr__ [U *] A reference to the variable to store the reduced value.
+         * @param __element_ptr__ [const T *] A reference to the element to insert.
+         * @param __ordering_comparator__ [int (*)(const T *, const T *)] The ordering comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was inserted.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If malloc fails.
          * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__, __result_ptr__) do { \
+        #define LinkedList_insert_sorted_by_ref(__list_ptr__, __element_ptr__, __ordering_comparator__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            typeof(__initial_value__) __accumulator__ = (__initial_value__); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((typeof(**(__list_ptr__)) *)__node__->element) = *(__element_ptr__); \
             __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __accumulator__ = (__reducer__)(__accumulator__, *((typeof(**(__list_ptr__)) *)__current_node__->element)); \
+            size_t __insert_index__ = 0; \
+            while (__current_node__ != NULL && __LinkedList_compare_refs__(__ordering_comparator__, typeof(**(__list_ptr__)), __current_node__, __node__) < 0) { \
                 __current_node__ = __current_node__->next; \
+                __insert_index__++; \
             } \
-            *(__result_ptr__) = __accumulator__; \
+            __node__->next = __current_node__; \
+            if (__current_node__ != NULL) { \
+                __node__->previous = __current_node__->previous; \
+                __current_node__->previous = __node__; \
+            } else { \
+                __node__->previous = __temp_list__->tail; \
+                __temp_list__->tail = __node__; \
+            } \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = __node__; \
+            } else { \
+                __temp_list__->head = __node__; \
+            } \
+            __temp_list__->length++; \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __insert_index__; \
+            *(__result_ptr__) = __insert_index__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Reduces the list to a single value.
+         * Inserts an element at the correct position given an ordered list, the comparator receives references to the elements.
+         * The element is copied once, into its node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __reducer__ [U (*)(U, T)] The reducer.
-         * @param __initial_value__ [U] The initial value.
-         * @param __result_ptr__ [U *] A reference to the variable to store the reduced value.
+         * @param __element_ptr__ [const T *] A reference to the element to insert.
+         * @param __ordering_comparator__ [int (*)(const T *, const T *)] The ordering comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was inserted.
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If malloc fails.
          * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_insert_sorted_by_ref(__list_ptr__, __element_ptr__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __list_element_type__ __accumulator__ = (__initial_value__); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(*(__element_ptr__))); \
+            __Node *__node__ = __node_init(__temp_list__->element_size); \
+            *((__list_element_type__ *)__node__->element) = *(__element_ptr__); \
             __Node *__current_node__ = __temp_list__->head; \
-            while (__current_node__ != NULL) { \
-                __accumulator__ = (__reducer__)(__accumulator__, *((__list_element_type__ *)__current_node__->element)); \
+            size_t __insert_index__ = 0; \
+            while (__current_node__ != NULL && __LinkedList_compare_refs__(__ordering_comparator__, __list_element_type__, __current_node__, __node__) < 0) { \
                 __current_node__ = __current_node__->next; \
+                __insert_index__++; \
             } \
-            *(__result_ptr__) = __accumulator__; \
+            __node__->next = __current_node__; \
+            if (__current_node__ != NULL) { \
+                __node__->previous = __current_node__->previous; \
+                __current_node__->previous = __node__; \
+            } else { \
+                __node__->previous = __temp_list__->tail; \
+                __temp_list__->tail = __node__; \
+            } \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = __node__; \
+            } else { \
+                __temp_list__->head = __node__; \
+            } \
+            __temp_list__->length++; \
+            __temp_list__->cached = __node__; \
+            __temp_list__->cached_index = __insert_index__; \
+            *(__result_ptr__) = __insert_index__; \
         } while(0)
     #endif
 #endif
 
+/**
+ * Public
+ * 
+ * Concatenates two lists.
+ * @param __list_ptr1__ [T **] A reference to the first list.
+ * @param __list_ptr2__ [T **] A reference to the second list.
+ * @throw [assert] If the reference to the first list is NULL.
+ * @throw [assert] If the first list is NULL.
+ * @throw [assert] If the reference to the second list is NULL.
+ * @throw [assert] If the second list is NULL.
+ * @throw [assert] If the element sizes of the lists are not the same.
+ * @throw [assert] If malloc fails.
+ */
+#define LinkedList_concat(__list_ptr1__, __list_ptr2__) do { \
+    assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+    assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+    LinkedList *__temp_list1__ = (LinkedList *)(*(__list_ptr1__)); \
+    LinkedList *__temp_list2__ = (LinkedList *)(*(__list_ptr2__)); \
+    __linkedlist_detach(__temp_list1__); \
+    assert(__temp_list1__->element_size == __temp_list2__->element_size); \
+    __Node *__current_node__ = __temp_list2__->head; \
+    while (__current_node__ != NULL) { \
+        __Node *__node__ = __node_init(__temp_list1__->element_size); \
+        memcpy(__node__->element, __current_node__->element, __temp_list1__->element_size); \
+        if (__temp_list1__->head == NULL) { \
+            __temp_list1__->head = __node__; \
+        } else { \
+            __temp_list1__->tail->next = __node__; \
+            __node__->previous = __temp_list1__->tail; \
+        } \
+        __temp_list1__->tail = __node__; \
+        __temp_list1__->length++; \
+        __current_node__ = __current_node__->next; \
+    } \
+} while(0)
+
 #if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
     #if COMPILER_SUPPORTS_TYPEOF
         /**
          * Public
          * 
-         * Checks if any element in the list satisfies the condition.
+         * Removes the last element from the list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
-         * @return [bool] True if any element satisfies the condition, false otherwise.
+         * @return [T] The removed element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_any(__list_ptr__, __func__) ({ \
+        #define LinkedList_pop(__list_ptr__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = false; \
-            while (__current_node__ != NULL) { \
-                if ((__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
-                    __result__ = true; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->tail; \
+            typeof(**(__list_ptr__)) __element__ = *((typeof(**(__list_ptr__)) *)__node__->element); \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = NULL; \
+                __temp_list__->tail = __node__->previous; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
             } \
-            __result__; \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->previous; \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
+            __element__; \
         })
     #else
         /**
          * Public
          * 
-         * Checks if any element in the list satisfies the condition.
+         * Removes the last element from the list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [bool] True if any element satisfies the condition, false otherwise.
+         * @return [T] The removed element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_any(__list_ptr__, __func__, __list_element_type__) ({ \
+        #define LinkedList_pop(__list_ptr__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = false; \
-            while (__current_node__ != NULL) { \
-                if ((__func__)(*((__list_element_type__ *)__current_node__->element))) { \
-                    __result__ = true; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->tail; \
+            __list_element_type__ __element__ = *((__list_element_type__ *)__node__->element); \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = NULL; \
+                __temp_list__->tail = __node__->previous; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
             } \
-            __result__; \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->previous; \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
+            __element__; \
         })
     #endif
 #else
@@ -2455,56 +2420,70 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Checks if any element in the list satisfies the condition.
+         * Removes the last element from the list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
-         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the result pointer is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_any(__list_ptr__, __func__, __result_ptr__) do { \
+        #define LinkedList_pop(__list_ptr__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = false; \
-            while (__current_node__ != NULL) { \
-                if ((__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
-                    __result__ = true; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->tail; \
+            if (__result_ptr__ != NULL) { \
+                *(__result_ptr__) = *((typeof(**(__list_ptr__)) *)__node__->element); \
             } \
-            *(__result_ptr__) = __result__; \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = NULL; \
+                __temp_list__->tail = __node__->previous; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
+            } \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->previous; \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Checks if any element in the list satisfies the condition.
+         * Removes the last element from the list.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
-         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the result pointer is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_any(__list_ptr__, __func__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_pop(__list_ptr__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = false; \
-            while (__current_node__ != NULL) { \
-                if ((__func__)(*((__list_element_type__ *)__current_node__->element))) { \
-                    __result__ = true; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->tail; \
+            if (__result_ptr__ != NULL) { \
+                *(__result_ptr__) = *((__list_element_type__ *) __node__->element); \
             } \
-            *(__result_ptr__) = __result__; \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = NULL; \
+                __temp_list__->tail = __node__->previous; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
+            } \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->previous; \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
         } while(0)
     #endif
 #endif
@@ -2514,52 +2493,70 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Checks if all elements in the list satisfy the condition.
+         * Removes the first element from the list in O(1), the cached node stays cached unless it is the removed one.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
-         * @return [bool] True if all elements satisfy the condition, false otherwise.
+         * @return [T] The removed element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_all(__list_ptr__, __func__) ({ \
+        #define LinkedList_pop_front(__list_ptr__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = true; \
-            while (__current_node__ != NULL) { \
-                if (!(__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
-                    __result__ = false; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->head; \
+            typeof(**(__list_ptr__)) __element__ = *((typeof(**(__list_ptr__)) *)__node__->element); \
+            if (__node__->next != NULL) { \
+                __node__->next->previous = NULL; \
+                __temp_list__->head = __node__->next; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
             } \
-            __result__; \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->next; \
+            } else if (__temp_list__->cached != NULL) { \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
+            __element__; \
         })
     #else
         /**
          * Public
          * 
-         * Checks if all elements in the list satisfy the condition.
+         * Removes the first element from the list in O(1), the cached node stays cached unless it is the removed one.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [bool] True if all elements satisfy the condition, false otherwise.
+         * @return [T] The removed element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_all(__list_ptr__, __func__, __list_element_type__) ({ \
+        #define LinkedList_pop_front(__list_ptr__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = true; \
-            while (__current_node__ != NULL) { \
-                if (!(__func__)(*((__list_element_type__ *)__current_node__->element))) { \
-                    __result__ = false; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->head; \
+            __list_element_type__ __element__ = *((__list_element_type__ *)__node__->element); \
+            if (__node__->next != NULL) { \
+                __node__->next->previous = NULL; \
+                __temp_list__->head = __node__->next; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
             } \
-            __result__; \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->next; \
+            } else if (__temp_list__->cached != NULL) { \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
+            __element__; \
         })
     #endif
 #else
@@ -2567,56 +2564,74 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Checks if all elements in the list satisfy the condition.
+         * Removes the first element from the list in O(1), the cached node stays cached unless it is the removed one.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
-         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the result pointer is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_all(__list_ptr__, __func__, __result_ptr__) do { \
+        #define LinkedList_pop_front(__list_ptr__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = true; \
-            while (__current_node__ != NULL) { \
-                if (!(__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
-                    __result__ = false; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->head; \
+            typeof(**(__list_ptr__)) __element__ = *((typeof(**(__list_ptr__)) *)__node__->element); \
+            if (__node__->next != NULL) { \
+                __node__->next->previous = NULL; \
+                __temp_list__->head = __node__->next; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
+            } \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->next; \
+            } else if (__temp_list__->cached != NULL) { \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
+            if ((__result_ptr__) != NULL) { \
+                *(__result_ptr__) = __element__; \
             } \
-            *(__result_ptr__) = __result__; \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Checks if all elements in the list satisfy the condition.
+         * Removes the first element from the list in O(1), the cached node stays cached unless it is the removed one.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __func__ [bool (*)(T)] The condition.
-         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the result pointer is NULL.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_all(__list_ptr__, __func__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_pop_front(__list_ptr__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
-            assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            __Node *__current_node__ = __temp_list__->head; \
-            bool __result__ = true; \
-            while (__current_node__ != NULL) { \
-                if (!(__func__)(*((__list_element_type__ *)__current_node__->element))) { \
-                    __result__ = false; \
-                    break; \
-                } \
-                __current_node__ = __current_node__->next; \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->length > 0); \
+            __Node *__node__ = __temp_list__->head; \
+            __list_element_type__ __element__ = *((__list_element_type__ *)__node__->element); \
+            if (__node__->next != NULL) { \
+                __node__->next->previous = NULL; \
+                __temp_list__->head = __node__->next; \
+            } else { \
+                __temp_list__->head = NULL; \
+                __temp_list__->tail = NULL; \
+            } \
+            if (__temp_list__->cached == __node__) { \
+                __temp_list__->cached = __node__->next; \
+            } else if (__temp_list__->cached != NULL) { \
+                __temp_list__->cached_index--; \
+            } \
+            __temp_list__->length--; \
+            free(__node__); \
+            if ((__result_ptr__) != NULL) { \
+                *(__result_ptr__) = __element__; \
             } \
-            *(__result_ptr__) = __result__; \
         } while(0)
     #endif
 #endif
@@ -2626,106 +2641,36 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Slices the list.
+         * Gets a copy of the first element of the list in O(1), without touching the cached node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __start__ [size_t] The start index.
-         * @param __end__ [size_t] The end index.
-         * @param __step__ [size_t] The step.
-         * @return [T *] The sliced list.
+         * @return [T] The first element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the start index is out of bounds.
-         * @throw [assert] If the end index is out of bounds.
-         * @throw [assert] If the start index is greater than or equal to the end index.
-         * @throw [assert] If the step is less than or equal to 0.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__) ({ \
+        #define LinkedList_peek_front(__list_ptr__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
-            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
-            assert(__start__ < __end__); \
-            assert(__step__ > 0); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __start__; __i__++) { \
-                __current_node__ = __current_node__->next; \
-            } \
-            while (__i__ < __end__) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
-                } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
-                    __current_node__ = __current_node__->next; \
-                    __i__++; \
-                    if (__i__ >= __end__) { \
-                        break; \
-                    } \
-                } \
-            } \
-            __new_list__; \
+            assert(__temp_list__->length > 0); \
+            *((typeof(**(__list_ptr__)) *)__temp_list__->head->element); \
         })
     #else
         /**
          * Public
          * 
-         * Slices the list.
+         * Gets a copy of the first element of the list in O(1), without touching the cached node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __start__ [size_t] The start index.
-         * @param __end__ [size_t] The end index.
-         * @param __step__ [size_t] The step.
          * @param __list_element_type__ [type] The type of the elements in the list.
-         * @return [T *] The sliced list.
+         * @return [T] The first element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the start index is out of bounds.
-         * @throw [assert] If the end index is out of bounds.
-         * @throw [assert] If the start index is greater than or equal to the end index.
-         * @throw [assert] If the step is less than or equal to 0.
+         * @throw [assert] If the list is empty.
          */
-        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__, __list_element_type__) ({ \
+        #define LinkedList_peek_front(__list_ptr__, __list_element_type__) ({ \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
-            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
-            assert(__start__ < __end__); \
-            assert(__step__ > 0); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __start__; __i__++) { \
-                __current_node__ = __current_node__->next; \
-            } \
-            while (__i__ < __end__) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
-                } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
-                    __current_node__ = __current_node__->next; \
-                    __i__++; \
-                    if (__i__ >= __end__) { \
-                        break; \
-                    } \
-                } \
-            } \
-            __new_list__; \
+            assert(__temp_list__->length > 0); \
+            *((__list_element_type__ *)__temp_list__->head->element); \
         })
     #endif
 #else
@@ -2733,114 +2678,4605 @@ void __linkedlist_locate_nearest_node(void *list_ptr, size_t index, __Node **res
         /**
          * Public
          * 
-         * Slices the list.
+         * Gets a copy of the first element of the list in O(1), without touching the cached node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __start__ [size_t] The start index.
-         * @param __end__ [size_t] The end index.
-         * @param __step__ [size_t] The step.
-         * @param __result_ptr__ [T **] A reference to the variable to store the sliced list.
+         * @param __result_ptr__ [T *] A reference to the variable to store the first element.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the start index is out of bounds.
-         * @throw [assert] If the end index is out of bounds.
-         * @throw [assert] If the start index is greater than or equal to the end index.
-         * @throw [assert] If the step is less than or equal to 0.
+         * @throw [assert] If the list is empty.
          * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__, __result_ptr__) do { \
+        #define LinkedList_peek_front(__list_ptr__, __result_ptr__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
-            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
-            assert(__start__ < __end__); \
-            assert(__step__ > 0); \
-            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __start__; __i__++) { \
-                __current_node__ = __current_node__->next; \
-            } \
-            while (__i__ < __end__) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
-                } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
-                    __current_node__ = __current_node__->next; \
-                    __i__++; \
-                    if (__i__ >= __end__) { \
-                        break; \
-                    } \
-                } \
-            } \
-            *(__result_ptr__) = __new_list__; \
+            assert(__temp_list__->length > 0); \
+            *(__result_ptr__) = *((typeof(**(__list_ptr__)) *)__temp_list__->head->element); \
         } while(0)
     #else
         /**
          * Public
          * 
-         * Slices the list.
+         * Gets a copy of the first element of the list in O(1), without touching the cached node.
          * @param __list_ptr__ [T **] A reference to the list.
-         * @param __start__ [size_t] The start index.
-         * @param __end__ [size_t] The end index.
-         * @param __step__ [size_t] The step.
-         * @param __result_ptr__ [T **] A reference to the variable to store the sliced list.
+         * @param __result_ptr__ [T *] A reference to the variable to store the first element.
          * @param __list_element_type__ [type] The type of the elements in the list.
          * @throw [assert] If the reference to the list is NULL.
          * @throw [assert] If the list is NULL.
-         * @throw [assert] If the start index is out of bounds.
-         * @throw [assert] If the end index is out of bounds.
-         * @throw [assert] If the start index is greater than or equal to the end index.
-         * @throw [assert] If the step is less than or equal to 0.
+         * @throw [assert] If the list is empty.
          * @throw [assert] If the result pointer is NULL.
          */
-        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__, __result_ptr__, __list_element_type__) do { \
+        #define LinkedList_peek_front(__list_ptr__, __result_ptr__, __list_element_type__) do { \
             assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
             assert((__result_ptr__) != NULL); \
             LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
-            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
-            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
-            assert(__start__ < __end__); \
-            assert(__step__ > 0); \
-            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
-            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
-            __Node *__current_node__ = __temp_list__->head; \
-            size_t __i__ = 0; \
-            for ( ; __i__ < __start__; __i__++) { \
-                __current_node__ = __current_node__->next; \
-            } \
-            while (__i__ < __end__) { \
-                __Node *__node__ = __node_init(__temp_list__->element_size); \
-                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
-                if (__temp_new_list__->head == NULL) { \
-                    __temp_new_list__->head = __node__; \
-                } else { \
-                    __temp_new_list__->tail->next = __node__; \
-                    __node__->previous = __temp_new_list__->tail; \
-                } \
-                __temp_new_list__->tail = __node__; \
-                __temp_new_list__->length++; \
-                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
-                    __current_node__ = __current_node__->next; \
-                    __i__++; \
-                    if (__i__ >= __end__) { \
-                        break; \
-                    } \
-                } \
-            } \
-            *(__result_ptr__) = __new_list__; \
+            assert(__temp_list__->length > 0); \
+            *(__result_ptr__) = *((__list_element_type__ *)__temp_list__->head->element); \
         } while(0)
     #endif
 #endif
 
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Gets a copy of the last element of the list in O(1), without touching the cached node.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @return [T] The last element.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
+         */
+        #define LinkedList_peek_back(__list_ptr__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert(__temp_list__->length > 0); \
+            *((typeof(**(__list_ptr__)) *)__temp_list__->tail->element); \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Gets a copy of the last element of the list in O(1), without touching the cached node.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T] The last element.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
+         */
+        #define LinkedList_peek_back(__list_ptr__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert(__temp_list__->length > 0); \
+            *((__list_element_type__ *)__temp_list__->tail->element); \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Gets a copy of the last element of the list in O(1), without touching the cached node.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __result_ptr__ [T *] A reference to the variable to store the last element.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_peek_back(__list_ptr__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert(__temp_list__->length > 0); \
+            *(__result_ptr__) = *((typeof(**(__list_ptr__)) *)__temp_list__->tail->element); \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Gets a copy of the last element of the list in O(1), without touching the cached node.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __result_ptr__ [T *] A reference to the variable to store the last element.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the list is empty.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_peek_back(__list_ptr__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert(__temp_list__->length > 0); \
+            *(__result_ptr__) = *((__list_element_type__ *)__temp_list__->tail->element); \
+        } while(0)
+    #endif
+#endif
+
+// in here i cannot use the same trick as list_pop because i don't have direct access to the element
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes the element at the specified index.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __index__ [size_t] The index to remove the element from.
+         * @return [T] The removed element.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the index is out of bounds.
+         */
+        #define LinkedList_remove_at(__list_ptr__, __index__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
+            __Node *__nearest_node__ = NULL; \
+            int __direction__ = 0; \
+            size_t __nearest_node_index__ = 0; \
+            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
+            if (__direction__ == 1) { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->next; \
+                    __nearest_node_index__++; \
+                } \
+            } else { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->previous; \
+                    __nearest_node_index__--; \
+                } \
+            } \
+            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
+                __temp_list__->cached = __nearest_node__->next; \
+                __temp_list__->cached_index = __index__; \
+            } else { \
+                __temp_list__->cached = NULL; \
+            } \
+            if (__nearest_node__->previous != NULL) { \
+                __nearest_node__->previous->next = __nearest_node__->next; \
+            } else { \
+                __temp_list__->head = __nearest_node__->next; \
+            } \
+            if (__nearest_node__->next != NULL) { \
+                __nearest_node__->next->previous = __nearest_node__->previous; \
+            } else { \
+                __temp_list__->tail = __nearest_node__->previous; \
+            } \
+            __temp_list__->length--; \
+            typeof(**(__list_ptr__)) __element__ = *((typeof(**(__list_ptr__)) *)__nearest_node__->element); \
+            free(__nearest_node__); \
+            __element__; \
+        })
+
+    #else
+        /**
+         * Public
+         * 
+         * Removes the element at the specified index.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __index__ [size_t] The index to remove the element from.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T] The removed element.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the index is out of bounds.
+         */
+        #define LinkedList_remove_at(__list_ptr__, __index__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
+            __Node *__nearest_node__ = NULL; \
+            int __direction__ = 0; \
+            size_t __nearest_node_index__ = 0; \
+            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
+            if (__direction__ == 1) { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->next; \
+                    __nearest_node_index__++; \
+                } \
+            } else { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->previous; \
+                    __nearest_node_index__--; \
+                } \
+            } \
+            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
+                __temp_list__->cached = __nearest_node__->next; \
+                __temp_list__->cached_index = __index__; \
+            } else { \
+                __temp_list__->cached = NULL; \
+            } \
+            if (__nearest_node__->previous != NULL) { \
+                __nearest_node__->previous->next = __nearest_node__->next; \
+            } else { \
+                __temp_list__->head = __nearest_node__->next; \
+            } \
+            if (__nearest_node__->next != NULL) { \
+                __nearest_node__->next->previous = __nearest_node__->previous; \
+            } else { \
+                __temp_list__->tail = __nearest_node__->previous; \
+            } \
+            __temp_list__->length--; \
+            __list_element_type__ __element__ = *((__list_element_type__ *)__nearest_node__->element); \
+            free(__nearest_node__); \
+            __element__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes the element at the specified index.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __index__ [size_t] The index to remove the element from.
+         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the index is out of bounds.
+         */
+        #define LinkedList_remove_at(__list_ptr__, __index__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
+            __Node *__nearest_node__ = NULL; \
+            int __direction__ = 0; \
+            size_t __nearest_node_index__ = 0; \
+            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
+            if (__direction__ == 1) { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->next; \
+                    __nearest_node_index__++; \
+                } \
+            } else { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->previous; \
+                    __nearest_node_index__--; \
+                } \
+            } \
+            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
+                __temp_list__->cached = __nearest_node__->next; \
+                __temp_list__->cached_index = __index__; \
+            } else { \
+                __temp_list__->cached = NULL; \
+            } \
+            if (__nearest_node__->previous != NULL) { \
+                __nearest_node__->previous->next = __nearest_node__->next; \
+            } else { \
+                __temp_list__->head = __nearest_node__->next; \
+            } \
+            if (__nearest_node__->next != NULL) { \
+                __nearest_node__->next->previous = __nearest_node__->previous; \
+            } else { \
+                __temp_list__->tail = __nearest_node__->previous; \
+            } \
+            __temp_list__->length--; \
+            if ((__result_ptr__) != NULL) { \
+                *(__result_ptr__) = *((typeof(**(__list_ptr__)) *)__nearest_node__->element); \
+            } \
+            free(__nearest_node__); \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Removes the element at the specified index.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __index__ [size_t] The index to remove the element from.
+         * @param __result_ptr__ [T *] A reference to the variable to store the removed element, if NULL the result will not be stored but the function will execute normally
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the index is out of bounds.
+         */
+        #define LinkedList_remove_at(__list_ptr__, __index__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert((__index__ >= 0) && (__index__ < __temp_list__->length)); \
+            __Node *__nearest_node__ = NULL; \
+            int __direction__ = 0; \
+            size_t __nearest_node_index__ = 0; \
+            __linkedlist_locate_nearest_node(__list_ptr__, __index__, &__nearest_node__, &__direction__, &__nearest_node_index__); \
+            if (__direction__ == 1) { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->next; \
+                    __nearest_node_index__++; \
+                } \
+            } else { \
+                while (__nearest_node_index__ != __index__) { \
+                    __nearest_node__ = __nearest_node__->previous; \
+                    __nearest_node_index__--; \
+                } \
+            } \
+            if (__nearest_node__->next != NULL && __nearest_node__->previous != NULL) { \
+                __temp_list__->cached = __nearest_node__->next; \
+                __temp_list__->cached_index = __index__; \
+            } else { \
+                __temp_list__->cached = NULL; \
+            } \
+            if (__nearest_node__->previous != NULL) { \
+                __nearest_node__->previous->next = __nearest_node__->next; \
+            } else { \
+                __temp_list__->head = __nearest_node__->next; \
+            } \
+            if (__nearest_node__->next != NULL) { \
+                __nearest_node__->next->previous = __nearest_node__->previous; \
+            } else { \
+                __temp_list__->tail = __nearest_node__->previous; \
+            } \
+            __temp_list__->length--; \
+            if ((__result_ptr__) != NULL) { \
+                *(__result_ptr__) = *((__list_element_type__ *)__nearest_node__->element); \
+            } \
+            free(__nearest_node__); \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes the first element that satisfies the boolean comparator.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __element__ [T] The element to remove.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @return [size_t] The index where the element was removed.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element was not found.
+         */
+        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)(*((typeof(**(__list_ptr__)) *)__node__->element), (__element__))) { \
+                    if (__node__->previous != NULL && __node__->next != NULL) { \
+                        __temp_list__->cached = __node__->next; \
+                        __temp_list__->cached_index = __i__; \
+                    } else { \
+                        __temp_list__->cached = NULL; \
+                    } \
+                    if (__node__->previous != NULL) { \
+                        __node__->previous->next = __node__->next; \
+                    } else { \
+                        __temp_list__->head = __node__->next; \
+                    } \
+                    if (__node__->next != NULL) { \
+                        __node__->next->previous = __node__->previous; \
+                    } else { \
+                        __temp_list__->tail = __node__->previous; \
+                    } \
+                    __temp_list__->length--; \
+                    __found__ = true; \
+                    break; \
+                } \
+                __node__ = __node__->next; \
+            } \
+            assert(__found__); \
+            __i__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Removes the first element that satisfies the boolean comparator.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __element__ [T] The element to remove.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [size_t] The index where the element was removed.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element was not found.
+         */
+        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)(*((__list_element_type__ *)__node__->element), (__element__))) { \
+                    if (__node__->previous != NULL && __node__->next != NULL) { \
+                        __temp_list__->cached = __node__->next; \
+                        __temp_list__->cached_index = __i__; \
+                    } else { \
+                        __temp_list__->cached = NULL; \
+                    } \
+                    if (__node__->previous != NULL) { \
+                        __node__->previous->next = __node__->next; \
+                    } else { \
+                        __temp_list__->head = __node__->next; \
+                    } \
+                    if (__node__->next != NULL) { \
+                        __node__->next->previous = __node__->previous; \
+                    } else { \
+                        __temp_list__->tail = __node__->previous; \
+                    } \
+                    __temp_list__->length--; \
+                    __found__ = true; \
+                    break; \
+                } \
+                __node__ = __node__->next; \
+            } \
+            assert(__found__); \
+            __i__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes the first element that satisfies the boolean comparator.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __element__ [T] The element to remove.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was removed, if NULL the result will not be stored but the function will execute normally
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element was not found.
+         */
+        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)(*((typeof(**(__list_ptr__)) *)__node__->element), (__element__))) { \
+                    if (__node__->previous != NULL && __node__->next != NULL) { \
+                        __temp_list__->cached = __node__->next; \
+                        __temp_list__->cached_index = __i__; \
+                    } else { \
+                        __temp_list__->cached = NULL; \
+                    } \
+                    if (__node__->previous != NULL) { \
+                        __node__->previous->next = __node__->next; \
+                    } else { \
+                        __temp_list__->head = __node__->next; \
+                    } \
+                    if (__node__->next != NULL) { \
+                        __node__->next->previous = __node__->previous; \
+                    } else { \
+                        __temp_list__->tail = __node__->previous; \
+                    } \
+                    __temp_list__->length--; \
+                    __found__ = true; \
+                    break; \
+                } \
+                __node__ = __node__->next; \
+            } \
+            assert(__found__); \
+            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __i__; } \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Removes the first element that satisfies the boolean comparator.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __element__ [T] The element to remove.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the index where the element was removed, if NULL the result will not be stored but the function will execute normally
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the element is not of the same type as the elements in the list. (gets checked by comparing the sizes)
+         * @throw [assert] If the element was not found.
+         */
+        #define LinkedList_remove_value(__list_ptr__, __element__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __linkedlist_detach(__temp_list__); \
+            assert(__temp_list__->element_size == sizeof(__element__)); \
+            __Node *__node__ = __temp_list__->head; \
+            bool __found__ = false; \
+            size_t __i__ = 0; \
+            for ( ; __i__ < __temp_list__->length; __i__++) { \
+                if ((__boolean_comparator__)(*((__list_element_type__ *)__node__->element), (__element__))) { \
+                    if (__node__->previous != NULL && __node__->next != NULL) { \
+                        __temp_list__->cached = __node__->next; \
+                        __temp_list__->cached_index = __i__; \
+                    } else { \
+                        __temp_list__->cached = NULL; \
+                    } \
+                    if (__node__->previous != NULL) { \
+                        __node__->previous->next = __node__->next; \
+                    } else { \
+                        __temp_list__->head = __node__->next; \
+                    } \
+                    if (__node__->next != NULL) { \
+                        __node__->next->previous = __node__->previous; \
+                    } else { \
+                        __temp_list__->tail = __node__->previous; \
+                    } \
+                    __temp_list__->length--; \
+                    __found__ = true; \
+                    break; \
+                } \
+                __node__ = __node__->next; \
+            } \
+            assert(__found__); \
+            if ((__result_ptr__) != NULL) { *(__result_ptr__) = __i__; } \
+        } while(0)
+    #endif
+#endif
+
+/**
+ * Public
+ * 
+ * Clears the list.
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ */
+#define LinkedList_clear(__list_ptr__) do { \
+    assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+    LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+    if (__linkedlist_release(__temp_list__)) { \
+        __node_free_chain(__temp_list__->head); \
+    } \
+    __temp_list__->head = NULL; \
+    __temp_list__->tail = NULL; \
+    __temp_list__->cached = NULL; \
+    __temp_list__->length = 0; \
+} while(0)
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Copies the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @return [T *] The copied list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_copy(__list_ptr__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Copies the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The copied list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_copy(__list_ptr__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Copies the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __result_ptr__ [T **] A reference to the variable to store the copied list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_copy(__list_ptr__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Copies the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __result_ptr__ [T **] A reference to the variable to store the copied list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_copy(__list_ptr__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Copies the list in O(1) by sharing its nodes (copy-on-write).
+     * The first modification of either list copies all of its nodes for that list only, in O(n), reading never copies anything.
+     * The shared nodes are reference counted atomically: a copy may be handed to another thread, which reads it and destroys it
+     * while the original keeps being modified. A single list (the original or a copy) must still not be used by two threads at once.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @return [T *] The copied list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_cow_copy(__list_ptr__) ((typeof(**(__list_ptr__)) *)__linkedlist_cow_copy(__list_ptr__))
+#else
+    /**
+     * Public
+     * 
+     * Copies the list in O(1) by sharing its nodes (copy-on-write).
+     * The first modification of either list copies all of its nodes for that list only, in O(n), reading never copies anything.
+     * The shared nodes are reference counted atomically: a copy may be handed to another thread, which reads it and destroys it
+     * while the original keeps being modified. A single list (the original or a copy) must still not be used by two threads at once.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @return [T *] The copied list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_cow_copy(__list_ptr__, __list_element_type__) ((__list_element_type__ *)__linkedlist_cow_copy(__list_ptr__))
+#endif
+
+/**
+ * Public
+ * 
+ * Reverses the list in place.
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * TODO: this function errors if the list is empty, check it out
+ */
+#define LinkedList_reverse(__list_ptr__) do { \
+    assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+    LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+    __linkedlist_detach(__temp_list__); \
+    __Node *__current_node__ = __temp_list__->head; \
+    while (__current_node__ != NULL) { \
+        __Node *__next_node__ = __current_node__->next; \
+        __current_node__->next = __current_node__->previous; \
+        __current_node__->previous = __next_node__; \
+        __current_node__ = __next_node__; \
+    } \
+    __Node *__temp_node__ = __temp_list__->head; \
+    __temp_list__->head = __temp_list__->tail; \
+    __temp_list__->tail = __temp_node__; \
+    __temp_list__->cached_index = __temp_list__->length - 1 - __temp_list__->cached_index; \
+} while(0)
+
+/**
+ * Private
+ * 
+ * A sorted run of nodes, used by the sort.
+ */
+typedef struct __LinkedListRun {
+    __Node *head;
+    __Node *tail;
+    size_t length;
+} __LinkedListRun;
+
+/**
+ * Private
+ * 
+ * The capacity of the run stack of the sort, the run lengths growing at least like the Fibonacci numbers down the stack it can't overflow.
+ */
+#define __LINKEDLIST_MAX_RUNS 96
+
+/**
+ * Private
+ * 
+ * Computes the length under which the runs found by the sort get extended with an insertion sort.
+ * @param length [size_t] The length of the list.
+ * @return [size_t] The minimum run length, between 8 and 16 for long lists.
+ */
+size_t __linkedlist_min_run_length(size_t length);
+
+/**
+ * Private
+ * 
+ * Compares the elements of two nodes with an ordering comparator taking the elements by value.
+ */
+#define __LinkedList_compare_values__(__ordering_comparator__, __list_element_type__, __node_a__, __node_b__) \
+    ((__ordering_comparator__)(*((__list_element_type__ *)(__node_a__)->element), *((__list_element_type__ *)(__node_b__)->element)))
+
+/**
+ * Private
+ * 
+ * Compares the elements of two nodes with an ordering comparator taking references to the elements, nothing gets copied.
+ */
+#define __LinkedList_compare_refs__(__ordering_comparator__, __list_element_type__, __node_a__, __node_b__) \
+    ((__ordering_comparator__)((const __list_element_type__ *)(__node_a__)->element, (const __list_element_type__ *)(__node_b__)->element))
+
+/**
+ * Private
+ * 
+ * Compares the elements of two nodes with a type erased comparator, `__list_element_type__` is unused.
+ */
+#define __LinkedList_compare_erased__(__ordering_comparator__, __list_element_type__, __node_a__, __node_b__) \
+    ((__ordering_comparator__)((const void *)(__node_a__)->element, (const void *)(__node_b__)->element))
+
+/**
+ * Private
+ * 
+ * Merges two sorted runs into one, relinking their nodes, the left run wins ties so the merge is stable.
+ * Runs already in order are chained in O(1), otherwise the longest segment won by the same side is spliced at once,
+ * so only the ends of each segment get relinked, and the tail of the result is known without walking to it.
+ * The end of a segment is found by comparing node by node, there is no TimSort galloping: without random access an exponential search
+ * still has to walk every node it skips, so it would only save comparisons at the price of walking the segment twice.
+ * @param __left_head__ [__Node *] The first node of the left run, its last node is followed by NULL, NULL if the run is empty.
+ * @param __left_tail__ [__Node *] The last node of the left run.
+ * @param __right_head__ [__Node *] The first node of the right run, its last node is followed by NULL, NULL if the run is empty.
+ * @param __right_tail__ [__Node *] The last node of the right run.
+ * @param __head_result_reference__ [__Node **] A reference to the variable to store the first node of the merged run.
+ * @param __tail_result_reference__ [__Node **] A reference to the variable to store the last node of the merged run.
+ * @param __ordering_comparator__ [comparator] The ordering comparator, called through `__compare__`.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __compare__ [macro] __LinkedList_compare_values__, __LinkedList_compare_refs__ or __LinkedList_compare_erased__.
+ */
+#define __LinkedList_merge__(__left_head__, __left_tail__, __right_head__, __right_tail__, __head_result_reference__, __tail_result_reference__, __ordering_comparator__, __list_element_type__, __compare__) do { \
+    __Node *__current_left__  = (__left_head__); \
+    __Node *__current_right__ = (__right_head__); \
+    if (__current_left__ == NULL || __current_right__ == NULL) { \
+        *(__head_result_reference__) = (__current_left__ != NULL) ? __current_left__   : __current_right__; \
+        *(__tail_result_reference__) = (__current_left__ != NULL) ? (__left_tail__) : (__right_tail__); \
+    } else if (__compare__(__ordering_comparator__, __list_element_type__, (__left_tail__), __current_right__) <= 0) { \
+        /* the runs are already in order */ \
+        (__left_tail__)->next       = __current_right__; \
+        __current_right__->previous = (__left_tail__); \
+        *(__head_result_reference__) = __current_left__; \
+        *(__tail_result_reference__) = (__right_tail__); \
+    } else if (__compare__(__ordering_comparator__, __list_element_type__, (__right_tail__), __current_left__) < 0) { \
+        /* the whole right run goes first */ \
+        (__right_tail__)->next     = __current_left__; \
+        __current_left__->previous = (__right_tail__); \
+        *(__head_result_reference__) = __current_right__; \
+        *(__tail_result_reference__) = (__left_tail__); \
+    } else { \
+        __Node *__merged_head__ = NULL; \
+        __Node *__merged_tail__ = NULL; \
+        bool __take_left__ = __compare__(__ordering_comparator__, __list_element_type__, __current_left__, __current_right__) <= 0; \
+        while (__current_left__ != NULL && __current_right__ != NULL) { \
+            __Node *__segment_head__; \
+            __Node *__segment_tail__; \
+            if (__take_left__) { \
+                __segment_head__ = __current_left__; \
+                do { \
+                    __segment_tail__ = __current_left__; \
+                    __current_left__ = __current_left__->next; \
+                } while (__current_left__ != NULL && __compare__(__ordering_comparator__, __list_element_type__, __current_left__, __current_right__) <= 0); \
+            } else { \
+                __segment_head__ = __current_right__; \
+                do { \
+                    __segment_tail__  = __current_right__; \
+                    __current_right__ = __current_right__->next; \
+                } while (__current_right__ != NULL && __compare__(__ordering_comparator__, __list_element_type__, __current_left__, __current_right__) > 0); \
+            } \
+            __take_left__ = !__take_left__; \
+            if (__merged_tail__ == NULL) { \
+                __merged_head__ = __segment_head__; \
+            } else { \
+                __merged_tail__->next      = __segment_head__; \
+                __segment_head__->previous = __merged_tail__; \
+            } \
+            __merged_tail__ = __segment_tail__; \
+        } \
+        __Node *__remaining__ = (__current_left__ != NULL) ? __current_left__ : __current_right__; \
+        __merged_tail__->next   = __remaining__; \
+        __remaining__->previous = __merged_tail__; \
+        *(__head_result_reference__) = __merged_head__; \
+        *(__tail_result_reference__) = (__current_left__ != NULL) ? (__left_tail__) : (__right_tail__); \
+    } \
+    if (*(__head_result_reference__) != NULL) { \
+        (*(__head_result_reference__))->previous = NULL; \
+    } \
+} while (0)
+
+/**
+ * Private
+ * 
+ * Merges the run at index `__index__` of the run stack with the run above it.
+ */
+#define __LinkedList_merge_runs__(__runs__, __run_count__, __index__, __ordering_comparator__, __list_element_type__, __compare__) do { \
+    __LinkedListRun *__left_run__  = &(__runs__)[(__index__)]; \
+    __LinkedListRun *__right_run__ = &(__runs__)[(__index__) + 1]; \
+    __Node *__merged_run_head__, *__merged_run_tail__; \
+    __LinkedList_merge__(__left_run__->head, __left_run__->tail, __right_run__->head, __right_run__->tail, &__merged_run_head__, &__merged_run_tail__, __ordering_comparator__, __list_element_type__, __compare__); \
+    __left_run__->head = __merged_run_head__; \
+    __left_run__->tail = __merged_run_tail__; \
+    __left_run__->length += __right_run__->length; \
+    if ((__index__) + 2 < (__run_count__)) { \
+        (__runs__)[(__index__) + 1] = (__runs__)[(__index__) + 2]; \
+    } \
+    (__run_count__)--; \
+} while (0)
+
+/**
+ * Private
+ * 
+ * Sorts the list in place with a stable natural merge sort, comparing the nodes with `__compare__`.
+ * The list is cut into its existing runs (strictly descending ones get reversed, short ones get extended with an insertion sort),
+ * which are merged through a stack keeping their lengths balanced as TimSort does (but without galloping, see __LinkedList_merge__),
+ * so a sorted or reverse sorted list is sorted in O(n) and a nearly sorted one in close to O(n).
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @param __ordering_comparator__ [comparator] The ordering comparator, called through `__compare__`.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __compare__ [macro] __LinkedList_compare_values__, __LinkedList_compare_refs__ or __LinkedList_compare_erased__.
+ */
+#define __LinkedList_sort__(__list_ptr__, __ordering_comparator__, __list_element_type__, __compare__) do { \
+    LinkedList *__sort_list__ = (LinkedList *)(*(__list_ptr__)); \
+    __linkedlist_detach(__sort_list__); \
+    /* if list contains 0 or 1 element do nothing */ \
+    if (__sort_list__->head != NULL && __sort_list__->head->next != NULL) { \
+        __LinkedListRun __runs__[__LINKEDLIST_MAX_RUNS]; \
+        size_t __run_count__ = 0; \
+        size_t __min_run_length__ = __linkedlist_min_run_length(__sort_list__->length); \
+        __Node *__curr__ = __sort_list__->head; /* points at the first node that is not part of a run yet */ \
+        while (__curr__ != NULL) { \
+            __LinkedListRun __run__ = { __curr__, __curr__, 1 }; \
+            __Node *__next__ = __curr__->next; \
+            if (__next__ != NULL && __compare__(__ordering_comparator__, __list_element_type__, __curr__, __next__) > 0) { \
+                while (__next__ != NULL && __compare__(__ordering_comparator__, __list_element_type__, __run__.tail, __next__) > 0) { \
+                    __run__.tail = __next__; \
+                    __next__ = __next__->next; \
+                    __run__.length++; \
+                } \
+                /* strictly descending, reversing it cannot reorder equal elements */ \
+                for (__Node *__node__ = __run__.head; __node__ != __next__; ) { \
+                    __Node *__following__ = __node__->next; \
+                    __node__->next = __node__->previous; \
+                    __node__->previous = __following__; \
+                    __node__ = __following__; \
+                } \
+                __Node *__swapped__ = __run__.head; \
+                __run__.head = __run__.tail; \
+                __run__.tail = __swapped__; \
+            } else { \
+                while (__next__ != NULL && __compare__(__ordering_comparator__, __list_element_type__, __run__.tail, __next__) <= 0) { \
+                    __run__.tail = __next__; \
+                    __next__ = __next__->next; \
+                    __run__.length++; \
+                } \
+            } \
+            __run__.head->previous = NULL; \
+            __run__.tail->next = NULL; \
+            /* extend a short run with an insertion sort, walking back from its tail */ \
+            while (__run__.length < __min_run_length__ && __next__ != NULL) { \
+                __Node *__node__ = __next__; \
+                __next__ = __next__->next; \
+                __Node *__position__ = __run__.tail; \
+                while (__position__ != NULL && __compare__(__ordering_comparator__, __list_element_type__, __position__, __node__) > 0) { \
+                    __position__ = __position__->previous; \
+                } \
+                __node__->previous = __position__; \
+                if (__position__ == NULL) { \
+                    __node__->next = __run__.head; \
+                    __run__.head->previous = __node__; \
+                    __run__.head = __node__; \
+                } else { \
+                    __node__->next = __position__->next; \
+                    if (__position__->next != NULL) { \
+                        __position__->next->previous = __node__; \
+                    } else { \
+                        __run__.tail = __node__; \
+                    } \
+                    __position__->next = __node__; \
+                } \
+                __run__.length++; \
+            } \
+            __curr__ = __next__; \
+            assert(__run_count__ < __LINKEDLIST_MAX_RUNS); \
+            __runs__[__run_count__++] = __run__; \
+            /* keep |runs[k - 2]| > |runs[k - 1]| + |runs[k]| and |runs[k - 1]| > |runs[k]| down the stack */ \
+            while (__run_count__ > 1) { \
+                size_t __k__ = __run_count__ - 2; \
+                if ((__k__ > 0 && __runs__[__k__ - 1].length <= __runs__[__k__].length + __runs__[__k__ + 1].length) || \
+                    (__k__ > 1 && __runs__[__k__ - 2].length <= __runs__[__k__ - 1].length + __runs__[__k__].length)) { \
+                    if (__runs__[__k__ - 1].length < __runs__[__k__ + 1].length) { \
+                        __k__--; \
+                    } \
+                } else if (__runs__[__k__].length > __runs__[__k__ + 1].length) { \
+                    break; \
+                } \
+                __LinkedList_merge_runs__(__runs__, __run_count__, __k__, __ordering_comparator__, __list_element_type__, __compare__); \
+            } \
+        } \
+        while (__run_count__ > 1) { \
+            size_t __k__ = __run_count__ - 2; \
+            if (__k__ > 0 && __runs__[__k__ - 1].length < __runs__[__k__ + 1].length) { \
+                __k__--; \
+            } \
+            __LinkedList_merge_runs__(__runs__, __run_count__, __k__, __ordering_comparator__, __list_element_type__, __compare__); \
+        } \
+        __sort_list__->head = __runs__[0].head; \
+        __sort_list__->tail = __runs__[0].tail; \
+    } \
+    __sort_list__->cached = NULL; \
+} while (0)
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Sorts the list in place.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     */
+    #define LinkedList_sort(__list_ptr__, __ordering_comparator__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        __LinkedList_sort__(__list_ptr__, (__ordering_comparator__), typeof(**(__list_ptr__)), __LinkedList_compare_values__); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Sorts the list in place.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     */
+    #define LinkedList_sort(__list_ptr__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        __LinkedList_sort__(__list_ptr__, (__ordering_comparator__), __list_element_type__, __LinkedList_compare_values__); \
+    } while(0)
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Sorts the list in place, the comparator receives references to the elements so none of them gets copied.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __ordering_comparator__ [int (*)(const T *, const T *)] The ordering comparator.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     */
+    #define LinkedList_sort_by_ref(__list_ptr__, __ordering_comparator__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        __LinkedList_sort__(__list_ptr__, (__ordering_comparator__), typeof(**(__list_ptr__)), __LinkedList_compare_refs__); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Sorts the list in place, the comparator receives references to the elements so none of them gets copied.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __ordering_comparator__ [int (*)(const T *, const T *)] The ordering comparator.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     */
+    #define LinkedList_sort_by_ref(__list_ptr__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        __LinkedList_sort__(__list_ptr__, (__ordering_comparator__), __list_element_type__, __LinkedList_compare_refs__); \
+    } while(0)
+#endif
+
+/**
+ * Private
+ * 
+ * An entry of the bounded heap of the top-k selections, the index of the node in the list breaks the ties so the selections are stable.
+ */
+typedef struct __LinkedListHeapEntry {
+    __Node *node;
+    size_t index;
+} __LinkedListHeapEntry;
+
+/**
+ * Private
+ * 
+ * Compares the elements of two nodes for the top-k selections, in the order of the comparator or in the reverse order.
+ * The reverse order swaps the operands rather than negating the result, a comparator may return INT_MIN.
+ * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __sign__ [int] 1 for the order of the comparator, -1 for the reverse order.
+ * @param __node_a__ [__Node *] The first node.
+ * @param __node_b__ [__Node *] The second node.
+ */
+#define __LinkedList_heap_compare__(__ordering_comparator__, __list_element_type__, __sign__, __node_a__, __node_b__) \
+    (((__sign__) > 0) \
+        ? __LinkedList_compare_values__(__ordering_comparator__, __list_element_type__, __node_a__, __node_b__) \
+        : __LinkedList_compare_values__(__ordering_comparator__, __list_element_type__, __node_b__, __node_a__))
+
+/**
+ * Private
+ * 
+ * Sifts an entry down from the root of a heap whose root is the worst entry, ordering the elements by the comparator (reversed when `__sign__` is -1), then by index.
+ * @param __heap__ [__LinkedListHeapEntry *] The heap, its root is free.
+ * @param __heap_size__ [size_t] The size of the heap.
+ * @param __entry__ [__LinkedListHeapEntry] The entry to place.
+ * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __sign__ [int] 1 to keep the smallest elements, -1 to keep the largest ones.
+ */
+#define __LinkedList_heap_sift_down__(__heap__, __heap_size__, __entry__, __ordering_comparator__, __list_element_type__, __sign__) do { \
+    size_t __position__ = 0; \
+    while (true) { \
+        size_t __child__ = 2 * __position__ + 1; \
+        if (__child__ >= (__heap_size__)) break; \
+        if (__child__ + 1 < (__heap_size__)) { \
+            int __order__ = __LinkedList_heap_compare__(__ordering_comparator__, __list_element_type__, __sign__, (__heap__)[__child__ + 1].node, (__heap__)[__child__].node); \
+            if (__order__ > 0 || (__order__ == 0 && (__heap__)[__child__ + 1].index > (__heap__)[__child__].index)) { \
+                __child__++; \
+            } \
+        } \
+        int __order__ = __LinkedList_heap_compare__(__ordering_comparator__, __list_element_type__, __sign__, (__heap__)[__child__].node, (__entry__).node); \
+        if (__order__ < 0 || (__order__ == 0 && (__heap__)[__child__].index < (__entry__).index)) break; \
+        (__heap__)[__position__] = (__heap__)[__child__]; \
+        __position__ = __child__; \
+    } \
+    (__heap__)[__position__] = (__entry__); \
+} while (0)
+
+/**
+ * Private
+ * 
+ * Selects the k first nodes of the list in the order of the comparator (reversed when `__sign__` is -1) in a single pass, with a bounded heap of k entries (O(n log k)).
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @param __k__ [size_t] The number of nodes to select, at most the length of the list get selected.
+ * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __sign__ [int] 1 to select the smallest elements, -1 to select the largest ones.
+ * @param __entries_reference__ [__LinkedListHeapEntry **] A reference to the variable to store the selected entries, in order, to be freed by the caller.
+ * @param __count_reference__ [size_t *] A reference to the variable to store the number of selected entries.
+ * @throw [assert] If malloc fails.
+ */
+#define __LinkedList_top_k_nodes__(__list_ptr__, __k__, __ordering_comparator__, __list_element_type__, __sign__, __entries_reference__, __count_reference__) do { \
+    LinkedList *__top_list__ = (LinkedList *)(*(__list_ptr__)); \
+    size_t __top_k__ = (__k__); \
+    if (__top_k__ > __top_list__->length) { \
+        __top_k__ = __top_list__->length; \
+    } \
+    __LinkedListHeapEntry *__heap__ = (__LinkedListHeapEntry *)malloc((__top_k__ > 0 ? __top_k__ : 1) * sizeof(__LinkedListHeapEntry)); \
+    assert(__heap__ != NULL); \
+    size_t __heap_size__ = 0; \
+    size_t __top_index__ = 0; \
+    /* the heap keeps the k best entries seen so far, its root being the worst of them */ \
+    for (__Node *__top_node__ = __top_list__->head; __top_node__ != NULL && __top_k__ > 0; __top_node__ = __top_node__->next, __top_index__++) { \
+        __LinkedListHeapEntry __entry__ = { __top_node__, __top_index__ }; \
+        if (__heap_size__ < __top_k__) { \
+            /* sift up, on a tie the entry is the newest so it is the worst */ \
+            size_t __position__ = __heap_size__++; \
+            while (__position__ > 0) { \
+                size_t __parent__ = (__position__ - 1) / 2; \
+                if (__LinkedList_heap_compare__(__ordering_comparator__, __list_element_type__, __sign__, __heap__[__parent__].node, __top_node__) > 0) break; \
+                __heap__[__position__] = __heap__[__parent__]; \
+                __position__ = __parent__; \
+            } \
+            __heap__[__position__] = __entry__; \
+        } else if (__LinkedList_heap_compare__(__ordering_comparator__, __list_element_type__, __sign__, __top_node__, __heap__[0].node) < 0) { \
+            __LinkedList_heap_sift_down__(__heap__, __heap_size__, __entry__, __ordering_comparator__, __list_element_type__, __sign__); \
+        } \
+    } \
+    /* pop the worst entry to the end until the heap is sorted */ \
+    for (size_t __end__ = __heap_size__; __end__ > 1; __end__--) { \
+        __LinkedListHeapEntry __worst__ = __heap__[0]; \
+        __LinkedListHeapEntry __last__ = __heap__[__end__ - 1]; \
+        __LinkedList_heap_sift_down__(__heap__, __end__ - 1, __last__, __ordering_comparator__, __list_element_type__, __sign__); \
+        __heap__[__end__ - 1] = __worst__; \
+    } \
+    *(__entries_reference__) = __heap__; \
+    *(__count_reference__) = __heap_size__; \
+} while (0)
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new list of the k smallest elements of the list in ascending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_nsmallest(__list_ptr__, __k__, __ordering_comparator__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), typeof(**(__list_ptr__)), 1, &__entries__, &__entry_count__); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new list of the k smallest elements of the list in ascending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_nsmallest(__list_ptr__, __k__, __ordering_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), __list_element_type__, 1, &__entries__, &__entry_count__); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new list of the k smallest elements of the list in ascending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_nsmallest(__list_ptr__, __k__, __ordering_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), typeof(**(__list_ptr__)), 1, &__entries__, &__entry_count__); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new list of the k smallest elements of the list in ascending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_nsmallest(__list_ptr__, __k__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), __list_element_type__, 1, &__entries__, &__entry_count__); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new list of the k largest elements of the list in descending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_nlargest(__list_ptr__, __k__, __ordering_comparator__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), typeof(**(__list_ptr__)), -1, &__entries__, &__entry_count__); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new list of the k largest elements of the list in descending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_nlargest(__list_ptr__, __k__, __ordering_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), __list_element_type__, -1, &__entries__, &__entry_count__); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new list of the k largest elements of the list in descending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_nlargest(__list_ptr__, __k__, __ordering_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), typeof(**(__list_ptr__)), -1, &__entries__, &__entry_count__); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new list of the k largest elements of the list in descending order, in a single pass with a bounded heap (O(n log k) with k elements of memory).
+         * Equal elements keep their order in the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __k__ [size_t] The number of elements, the whole list gets sorted if it is greater than its length.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_nlargest(__list_ptr__, __k__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            __LinkedListHeapEntry *__entries__; \
+            size_t __entry_count__; \
+            __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), __list_element_type__, -1, &__entries__, &__entry_count__); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+                LinkedList_push_ptr(&__new_list__, __entries__[__i__].node->element); \
+            } \
+            free(__entries__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Sorts the first k positions of the list in place, they get the k smallest elements in ascending order (equal elements keep their order)
+     * and the other elements follow in their original order, the nodes get relinked in O(n log k) and none gets copied.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __k__ [size_t] The number of positions to sort, the whole list gets sorted if it is greater than its length.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_partial_sort(__list_ptr__, __k__, __ordering_comparator__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        __LinkedListHeapEntry *__entries__; \
+        size_t __entry_count__; \
+        __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), typeof(**(__list_ptr__)), 1, &__entries__, &__entry_count__); \
+        /* unlink the selected nodes, then chain them in order in front of the rest */ \
+        for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+            __Node *__node__ = __entries__[__i__].node; \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = __node__->next; \
+            } else { \
+                __temp_list__->head = __node__->next; \
+            } \
+            if (__node__->next != NULL) { \
+                __node__->next->previous = __node__->previous; \
+            } else { \
+                __temp_list__->tail = __node__->previous; \
+            } \
+        } \
+        for (size_t __i__ = __entry_count__; __i__-- > 0; ) { \
+            __Node *__node__ = __entries__[__i__].node; \
+            __node__->previous = NULL; \
+            __node__->next = __temp_list__->head; \
+            if (__temp_list__->head != NULL) { \
+                __temp_list__->head->previous = __node__; \
+            } else { \
+                __temp_list__->tail = __node__; \
+            } \
+            __temp_list__->head = __node__; \
+        } \
+        __temp_list__->cached = NULL; \
+        free(__entries__); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Sorts the first k positions of the list in place, they get the k smallest elements in ascending order (equal elements keep their order)
+     * and the other elements follow in their original order, the nodes get relinked in O(n log k) and none gets copied.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __k__ [size_t] The number of positions to sort, the whole list gets sorted if it is greater than its length.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_partial_sort(__list_ptr__, __k__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        __LinkedListHeapEntry *__entries__; \
+        size_t __entry_count__; \
+        __LinkedList_top_k_nodes__(__list_ptr__, (__k__), (__ordering_comparator__), __list_element_type__, 1, &__entries__, &__entry_count__); \
+        /* unlink the selected nodes, then chain them in order in front of the rest */ \
+        for (size_t __i__ = 0; __i__ < __entry_count__; __i__++) { \
+            __Node *__node__ = __entries__[__i__].node; \
+            if (__node__->previous != NULL) { \
+                __node__->previous->next = __node__->next; \
+            } else { \
+                __temp_list__->head = __node__->next; \
+            } \
+            if (__node__->next != NULL) { \
+                __node__->next->previous = __node__->previous; \
+            } else { \
+                __temp_list__->tail = __node__->previous; \
+            } \
+        } \
+        for (size_t __i__ = __entry_count__; __i__-- > 0; ) { \
+            __Node *__node__ = __entries__[__i__].node; \
+            __node__->previous = NULL; \
+            __node__->next = __temp_list__->head; \
+            if (__temp_list__->head != NULL) { \
+                __temp_list__->head->previous = __node__; \
+            } else { \
+                __temp_list__->tail = __node__; \
+            } \
+            __temp_list__->head = __node__; \
+        } \
+        __temp_list__->cached = NULL; \
+        free(__entries__); \
+    } while(0)
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Merges the second sorted list into the first one in O(n + m), relinking the nodes of the second list, nothing gets allocated nor copied.
+     * The merge is stable, on a tie the elements of the first list come first, the second list is left empty.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the merged list.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left empty.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails (when a list shares its nodes with a copy-on-write copy).
+     */
+    #define LinkedList_merge_sorted(__list_ptr1__, __list_ptr2__, __ordering_comparator__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        LinkedList *__merge_list1__ = (LinkedList *)(*(__list_ptr1__)); \
+        LinkedList *__merge_list2__ = (LinkedList *)(*(__list_ptr2__)); \
+        assert(__merge_list1__->element_size == __merge_list2__->element_size); \
+        assert(__merge_list1__ != __merge_list2__); \
+        __linkedlist_detach(__merge_list1__); \
+        __linkedlist_detach(__merge_list2__); \
+        __Node *__merge_head__, *__merge_tail__; \
+        __LinkedList_merge__(__merge_list1__->head, __merge_list1__->tail, __merge_list2__->head, __merge_list2__->tail, &__merge_head__, &__merge_tail__, (__ordering_comparator__), typeof(**(__list_ptr1__)), __LinkedList_compare_values__); \
+        __merge_list1__->head = __merge_head__; \
+        __merge_list1__->tail = __merge_tail__; \
+        __merge_list1__->length += __merge_list2__->length; \
+        __merge_list1__->cached = NULL; \
+        __merge_list2__->head = NULL; \
+        __merge_list2__->tail = NULL; \
+        __merge_list2__->length = 0; \
+        __merge_list2__->cached = NULL; \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Merges the second sorted list into the first one in O(n + m), relinking the nodes of the second list, nothing gets allocated nor copied.
+     * The merge is stable, on a tie the elements of the first list come first, the second list is left empty.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the merged list.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left empty.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails (when a list shares its nodes with a copy-on-write copy).
+     */
+    #define LinkedList_merge_sorted(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        LinkedList *__merge_list1__ = (LinkedList *)(*(__list_ptr1__)); \
+        LinkedList *__merge_list2__ = (LinkedList *)(*(__list_ptr2__)); \
+        assert(__merge_list1__->element_size == __merge_list2__->element_size); \
+        assert(__merge_list1__ != __merge_list2__); \
+        __linkedlist_detach(__merge_list1__); \
+        __linkedlist_detach(__merge_list2__); \
+        __Node *__merge_head__, *__merge_tail__; \
+        __LinkedList_merge__(__merge_list1__->head, __merge_list1__->tail, __merge_list2__->head, __merge_list2__->tail, &__merge_head__, &__merge_tail__, (__ordering_comparator__), __list_element_type__, __LinkedList_compare_values__); \
+        __merge_list1__->head = __merge_head__; \
+        __merge_list1__->tail = __merge_tail__; \
+        __merge_list1__->length += __merge_list2__->length; \
+        __merge_list1__->cached = NULL; \
+        __merge_list2__->head = NULL; \
+        __merge_list2__->tail = NULL; \
+        __merge_list2__->length = 0; \
+        __merge_list2__->cached = NULL; \
+    } while(0)
+#endif
+
+/**
+ * Private
+ * 
+ * Sifts an entry down from the root of the heap of LinkedList_merge_k, whose root is the first entry: the smallest element, from the first list on a tie.
+ * @param __heap__ [__LinkedListHeapEntry *] The heap, its root is free, the indexes are the indexes of the lists.
+ * @param __heap_size__ [size_t] The size of the heap.
+ * @param __entry__ [__LinkedListHeapEntry] The entry to place.
+ * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator.
+ * @param __list_element_type__ [type] The type of the elements in the lists.
+ */
+#define __LinkedList_merge_heap_sift_down__(__heap__, __heap_size__, __entry__, __ordering_comparator__, __list_element_type__) do { \
+    size_t __position__ = 0; \
+    while (true) { \
+        size_t __child__ = 2 * __position__ + 1; \
+        if (__child__ >= (__heap_size__)) break; \
+        if (__child__ + 1 < (__heap_size__)) { \
+            int __order__ = __LinkedList_compare_values__(__ordering_comparator__, __list_element_type__, (__heap__)[__child__ + 1].node, (__heap__)[__child__].node); \
+            if (__order__ < 0 || (__order__ == 0 && (__heap__)[__child__ + 1].index < (__heap__)[__child__].index)) { \
+                __child__++; \
+            } \
+        } \
+        int __order__ = __LinkedList_compare_values__(__ordering_comparator__, __list_element_type__, (__heap__)[__child__].node, (__entry__).node); \
+        if (__order__ > 0 || (__order__ == 0 && (__heap__)[__child__].index > (__entry__).index)) break; \
+        (__heap__)[__position__] = (__heap__)[__child__]; \
+        __position__ = __child__; \
+    } \
+    (__heap__)[__position__] = (__entry__); \
+} while (0)
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Merges k sorted lists into the first one in O(n log k), with a heap of the first remaining node of every list,
+     * the nodes get relinked, none gets copied. The merge is stable, on a tie the elements of the earlier list come first, the other lists are left empty.
+     * @param __lists__ [T **] An array of the k lists, sorted.
+     * @param __k__ [size_t] The number of lists.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @throw [assert] If the array of lists is NULL.
+     * @throw [assert] If k is 0.
+     * @throw [assert] If a list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_merge_k(__lists__, __k__, __ordering_comparator__) do { \
+        assert(((__lists__) != NULL) && ((__k__) > 0)); \
+        size_t __list_count__ = (__k__); \
+        LinkedList *__merged_list__ = (LinkedList *)(__lists__)[0]; \
+        __LinkedListHeapEntry *__heap__ = (__LinkedListHeapEntry *)malloc(__list_count__ * sizeof(__LinkedListHeapEntry)); \
+        assert(__heap__ != NULL); \
+        size_t __heap_size__ = 0; \
+        size_t __merged_length__ = 0; \
+        for (size_t __i__ = 0; __i__ < __list_count__; __i__++) { \
+            LinkedList *__list__ = (LinkedList *)(__lists__)[__i__]; \
+            assert(__list__ != NULL); \
+            assert(__list__->element_size == __merged_list__->element_size); \
+            __linkedlist_detach(__list__); \
+            __merged_length__ += __list__->length; \
+            if (__list__->head == NULL) continue; \
+            /* sift up, the entry comes from the latest list so it goes after the entries it ties with */ \
+            __LinkedListHeapEntry __entry__ = { __list__->head, __i__ }; \
+            size_t __position__ = __heap_size__++; \
+            while (__position__ > 0) { \
+                size_t __parent__ = (__position__ - 1) / 2; \
+                if (__LinkedList_compare_values__((__ordering_comparator__), typeof(**(__lists__)), __heap__[__parent__].node, __entry__.node) <= 0) break; \
+                __heap__[__position__] = __heap__[__parent__]; \
+                __position__ = __parent__; \
+            } \
+            __heap__[__position__] = __entry__; \
+            __list__->head = NULL; \
+            __list__->tail = NULL; \
+            __list__->length = 0; \
+            __list__->cached = NULL; \
+        } \
+        __Node *__merged_head__ = NULL; \
+        __Node *__merged_tail__ = NULL; \
+        while (__heap_size__ > 0) { \
+            __Node *__node__ = __heap__[0].node; \
+            __node__->previous = __merged_tail__; \
+            if (__merged_tail__ == NULL) { \
+                __merged_head__ = __node__; \
+            } else { \
+                __merged_tail__->next = __node__; \
+            } \
+            __merged_tail__ = __node__; \
+            /* the next node of the same list replaces the root, or the last entry does once the list is exhausted */ \
+            __LinkedListHeapEntry __entry__ = { __node__->next, __heap__[0].index }; \
+            if (__entry__.node == NULL) { \
+                __entry__ = __heap__[--__heap_size__]; \
+            } \
+            if (__heap_size__ > 0) { \
+                __LinkedList_merge_heap_sift_down__(__heap__, __heap_size__, __entry__, (__ordering_comparator__), typeof(**(__lists__))); \
+            } \
+        } \
+        if (__merged_tail__ != NULL) { \
+            __merged_tail__->next = NULL; \
+        } \
+        __merged_list__->head = __merged_head__; \
+        __merged_list__->tail = __merged_tail__; \
+        __merged_list__->length = __merged_length__; \
+        free(__heap__); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Merges k sorted lists into the first one in O(n log k), with a heap of the first remaining node of every list,
+     * the nodes get relinked, none gets copied. The merge is stable, on a tie the elements of the earlier list come first, the other lists are left empty.
+     * @param __lists__ [T **] An array of the k lists, sorted.
+     * @param __k__ [size_t] The number of lists.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the array of lists is NULL.
+     * @throw [assert] If k is 0.
+     * @throw [assert] If a list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_merge_k(__lists__, __k__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__lists__) != NULL) && ((__k__) > 0)); \
+        size_t __list_count__ = (__k__); \
+        LinkedList *__merged_list__ = (LinkedList *)(__lists__)[0]; \
+        __LinkedListHeapEntry *__heap__ = (__LinkedListHeapEntry *)malloc(__list_count__ * sizeof(__LinkedListHeapEntry)); \
+        assert(__heap__ != NULL); \
+        size_t __heap_size__ = 0; \
+        size_t __merged_length__ = 0; \
+        for (size_t __i__ = 0; __i__ < __list_count__; __i__++) { \
+            LinkedList *__list__ = (LinkedList *)(__lists__)[__i__]; \
+            assert(__list__ != NULL); \
+            assert(__list__->element_size == __merged_list__->element_size); \
+            __linkedlist_detach(__list__); \
+            __merged_length__ += __list__->length; \
+            if (__list__->head == NULL) continue; \
+            /* sift up, the entry comes from the latest list so it goes after the entries it ties with */ \
+            __LinkedListHeapEntry __entry__ = { __list__->head, __i__ }; \
+            size_t __position__ = __heap_size__++; \
+            while (__position__ > 0) { \
+                size_t __parent__ = (__position__ - 1) / 2; \
+                if (__LinkedList_compare_values__((__ordering_comparator__), __list_element_type__, __heap__[__parent__].node, __entry__.node) <= 0) break; \
+                __heap__[__position__] = __heap__[__parent__]; \
+                __position__ = __parent__; \
+            } \
+            __heap__[__position__] = __entry__; \
+            __list__->head = NULL; \
+            __list__->tail = NULL; \
+            __list__->length = 0; \
+            __list__->cached = NULL; \
+        } \
+        __Node *__merged_head__ = NULL; \
+        __Node *__merged_tail__ = NULL; \
+        while (__heap_size__ > 0) { \
+            __Node *__node__ = __heap__[0].node; \
+            __node__->previous = __merged_tail__; \
+            if (__merged_tail__ == NULL) { \
+                __merged_head__ = __node__; \
+            } else { \
+                __merged_tail__->next = __node__; \
+            } \
+            __merged_tail__ = __node__; \
+            /* the next node of the same list replaces the root, or the last entry does once the list is exhausted */ \
+            __LinkedListHeapEntry __entry__ = { __node__->next, __heap__[0].index }; \
+            if (__entry__.node == NULL) { \
+                __entry__ = __heap__[--__heap_size__]; \
+            } \
+            if (__heap_size__ > 0) { \
+                __LinkedList_merge_heap_sift_down__(__heap__, __heap_size__, __entry__, (__ordering_comparator__), __list_element_type__); \
+            } \
+        } \
+        if (__merged_tail__ != NULL) { \
+            __merged_tail__->next = NULL; \
+        } \
+        __merged_list__->head = __merged_head__; \
+        __merged_list__->tail = __merged_tail__; \
+        __merged_list__->length = __merged_length__; \
+        free(__heap__); \
+    } while(0)
+#endif
+
+/**
+ * Private
+ * 
+ * Walks two sorted lists once, like std::set_union and co (an element repeated in both lists is matched as many times as it is repeated in both),
+ * and pushes copies of the elements to keep to the result list.
+ * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+ * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+ * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+ * @param __list_element_type__ [type] The type of the elements in the lists.
+ * @param __keep_first_only__ [bool] Whether to keep the elements only in the first list.
+ * @param __keep_second_only__ [bool] Whether to keep the elements only in the second list.
+ * @param __keep_both__ [bool] Whether to keep the elements in both lists (the first list's copy).
+ * @param __result_list_ptr__ [T **] A reference to the result list.
+ */
+#define __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__, __keep_first_only__, __keep_second_only__, __keep_both__, __result_list_ptr__) do { \
+    LinkedList *__set_list1__ = (LinkedList *)(*(__list_ptr1__)); \
+    LinkedList *__set_list2__ = (LinkedList *)(*(__list_ptr2__)); \
+    assert(__set_list1__->element_size == __set_list2__->element_size); \
+    __Node *__set_node1__ = __set_list1__->head; \
+    __Node *__set_node2__ = __set_list2__->head; \
+    while (__set_node1__ != NULL || __set_node2__ != NULL) { \
+        int __order__ = (__set_node1__ == NULL) ? 1 : (__set_node2__ == NULL) ? -1 : __LinkedList_compare_values__(__ordering_comparator__, __list_element_type__, __set_node1__, __set_node2__); \
+        if (__order__ < 0) { \
+            if (__keep_first_only__) { \
+                LinkedList_push_ptr((__result_list_ptr__), __set_node1__->element); \
+            } \
+            __set_node1__ = __set_node1__->next; \
+        } else if (__order__ > 0) { \
+            if (__keep_second_only__) { \
+                LinkedList_push_ptr((__result_list_ptr__), __set_node2__->element); \
+            } \
+            __set_node2__ = __set_node2__->next; \
+        } else { \
+            if (__keep_both__) { \
+                LinkedList_push_ptr((__result_list_ptr__), __set_node1__->element); \
+            } \
+            __set_node1__ = __set_node1__->next; \
+            __set_node2__ = __set_node2__->next; \
+        } \
+    } \
+} while (0)
+
+/**
+ * Private
+ * 
+ * Same as __LinkedList_sorted_set_operation__ but the result replaces the first list:
+ * its nodes not to keep get unlinked and freed, and copies of the elements to keep from the second list get linked in their sorted positions.
+ * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+ * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+ * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+ * @param __list_element_type__ [type] The type of the elements in the lists.
+ * @param __keep_first_only__ [bool] Whether to keep the elements only in the first list.
+ * @param __keep_second_only__ [bool] Whether to keep the elements only in the second list.
+ * @param __keep_both__ [bool] Whether to keep the elements in both lists (the first list's node).
+ */
+#define __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__, __keep_first_only__, __keep_second_only__, __keep_both__) do { \
+    LinkedList *__set_list1__ = (LinkedList *)(*(__list_ptr1__)); \
+    LinkedList *__set_list2__ = (LinkedList *)(*(__list_ptr2__)); \
+    assert(__set_list1__->element_size == __set_list2__->element_size); \
+    assert(__set_list1__ != __set_list2__); \
+    __linkedlist_detach(__set_list1__); \
+    __Node *__set_removed__ = NULL; /* the unlinked nodes, freed at the end */ \
+    __Node *__set_node1__ = __set_list1__->head; \
+    __Node *__set_node2__ = __set_list2__->head; \
+    while (__set_node1__ != NULL || __set_node2__ != NULL) { \
+        int __order__ = (__set_node1__ == NULL) ? 1 : (__set_node2__ == NULL) ? -1 : __LinkedList_compare_values__(__ordering_comparator__, __list_element_type__, __set_node1__, __set_node2__); \
+        if (__order__ > 0) { \
+            if (__keep_second_only__) { \
+                /* link a copy before the current node of the first list */ \
+                __Node *__copy__ = __node_init(__set_list1__->element_size); \
+                memcpy(__copy__->element, __set_node2__->element, __set_list1__->element_size); \
+                __copy__->next = __set_node1__; \
+                __copy__->previous = (__set_node1__ != NULL) ? __set_node1__->previous : __set_list1__->tail; \
+                if (__copy__->previous != NULL) { \
+                    __copy__->previous->next = __copy__; \
+                } else { \
+                    __set_list1__->head = __copy__; \
+                } \
+                if (__set_node1__ != NULL) { \
+                    __set_node1__->previous = __copy__; \
+                } else { \
+                    __set_list1__->tail = __copy__; \
+                } \
+                __set_list1__->length++; \
+            } \
+            __set_node2__ = __set_node2__->next; \
+            continue; \
+        } \
+        __Node *__set_next1__ = __set_node1__->next; \
+        if ((__order__ < 0) ? !(__keep_first_only__) : !(__keep_both__)) { \
+            if (__set_node1__->previous != NULL) { \
+                __set_node1__->previous->next = __set_next1__; \
+            } else { \
+                __set_list1__->head = __set_next1__; \
+            } \
+            if (__set_next1__ != NULL) { \
+                __set_next1__->previous = __set_node1__->previous; \
+            } else { \
+                __set_list1__->tail = __set_node1__->previous; \
+            } \
+            __set_node1__->next = __set_removed__; \
+            __set_removed__ = __set_node1__; \
+            __set_list1__->length--; \
+        } \
+        if (__order__ == 0) { \
+            __set_node2__ = __set_node2__->next; \
+        } \
+        __set_node1__ = __set_next1__; \
+    } \
+    __set_list1__->cached = NULL; \
+    __node_free_chain(__set_removed__); \
+} while (0)
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in either list (an element repeated in both is kept as many times as in the list repeating it the most), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_union(__list_ptr1__, __list_ptr2__, __ordering_comparator__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, true, true, &__new_list__); \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in either list (an element repeated in both is kept as many times as in the list repeating it the most), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_union(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, true, true, &__new_list__); \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in either list (an element repeated in both is kept as many times as in the list repeating it the most), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_union(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, true, true, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in either list (an element repeated in both is kept as many times as in the list repeating it the most), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_union(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, true, true, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the union of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_union_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, true, true); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the union of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_union_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, true, true); \
+    } while(0)
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in both lists (an element repeated in both is kept as many times as in the list repeating it the least), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_intersection(__list_ptr1__, __list_ptr2__, __ordering_comparator__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), false, false, true, &__new_list__); \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in both lists (an element repeated in both is kept as many times as in the list repeating it the least), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_intersection(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, false, false, true, &__new_list__); \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in both lists (an element repeated in both is kept as many times as in the list repeating it the least), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_intersection(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), false, false, true, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in both lists (an element repeated in both is kept as many times as in the list repeating it the least), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_intersection(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, false, false, true, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the intersection of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_intersection_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), false, false, true); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the intersection of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_intersection_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, false, false, true); \
+    } while(0)
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements of the first list that are not in the second one (every repetition in the second list cancels one in the first list), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, false, false, &__new_list__); \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements of the first list that are not in the second one (every repetition in the second list cancels one in the first list), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, false, false, &__new_list__); \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements of the first list that are not in the second one (every repetition in the second list cancels one in the first list), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, false, false, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements of the first list that are not in the second one (every repetition in the second list cancels one in the first list), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, false, false, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the difference of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_difference_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, false, false); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the difference of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_difference_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, false, false); \
+    } while(0)
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in only one of the lists (repetitions cancel out one for one), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_symmetric_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, true, false, &__new_list__); \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in only one of the lists (repetitions cancel out one for one), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_sorted_symmetric_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, true, false, &__new_list__); \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in only one of the lists (repetitions cancel out one for one), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_symmetric_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            typeof(**(__list_ptr1__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr1__))); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, true, false, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Returns a new sorted list of the elements in only one of the lists (repetitions cancel out one for one), walking both sorted lists once (O(n + m)).
+         * @param __list_ptr1__ [T **] A reference to the first list, sorted.
+         * @param __list_ptr2__ [T **] A reference to the second list, sorted.
+         * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+         * @param __result_ptr__ [T **] A reference to the variable to store the new list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the first list is NULL.
+         * @throw [assert] If the first list is NULL.
+         * @throw [assert] If the reference to the second list is NULL.
+         * @throw [assert] If the second list is NULL.
+         * @throw [assert] If the element sizes of the lists are not the same.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_sorted_symmetric_difference(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            __LinkedList_sorted_set_operation__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, true, false, &__new_list__); \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the symmetric difference of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_symmetric_difference_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), typeof(**(__list_ptr1__)), true, true, false); \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Replaces the first sorted list with the symmetric difference of the two lists, walking both once (O(n + m)),
+     * the nodes of the first list that are dropped get freed and only the elements kept from the second list get copied.
+     * @param __list_ptr1__ [T **] A reference to the first list, sorted, receives the result.
+     * @param __list_ptr2__ [T **] A reference to the second list, sorted, left untouched.
+     * @param __ordering_comparator__ [int (*)(T, T)] The ordering comparator the lists are sorted by.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the first list is NULL.
+     * @throw [assert] If the first list is NULL.
+     * @throw [assert] If the reference to the second list is NULL.
+     * @throw [assert] If the second list is NULL.
+     * @throw [assert] If the element sizes of the lists are not the same.
+     * @throw [assert] If the two lists are the same list.
+     * @throw [assert] If malloc fails.
+     */
+    #define LinkedList_sorted_symmetric_difference_in_place(__list_ptr1__, __list_ptr2__, __ordering_comparator__, __list_element_type__) do { \
+        assert(((__list_ptr1__) != NULL) && (*(__list_ptr1__) != NULL)); \
+        assert(((__list_ptr2__) != NULL) && (*(__list_ptr2__) != NULL)); \
+        __LinkedList_sorted_set_operation_in_place__(__list_ptr1__, __list_ptr2__, (__ordering_comparator__), __list_element_type__, true, true, false); \
+    } while(0)
+#endif
+
+/**
+ * Public
+ * 
+ * Sorts the list in place by gathering its nodes into a temporary array, sorting the array with an introsort and relinking the nodes in one pass.
+ * Faster than LinkedList_sort on large unordered lists as the sort moves pointers around a contiguous array instead of chasing links,
+ * but it is not stable, if the array can't be allocated the list is sorted with LinkedList_sort's merge sort instead.
+ * @param list_ptr [T **] A reference to the list.
+ * @param ordering_comparator [int (*)(const void *, const void *)] The ordering comparator, receives references to the elements like qsort's.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the ordering comparator is NULL.
+ */
+void LinkedList_sort_fast(void *list_ptr, int (*ordering_comparator)(const void *, const void *));
+
+/**
+ * Public
+ * 
+ * Sorts the list in place by an unsigned integer key, with a stable LSD radix sort.
+ * The keys are extracted once into a temporary array of key and node pairs, which every pass distributes by one byte of the key,
+ * and the nodes are relinked in one pass at the end, so no element gets compared nor copied and the sort runs in O(n * key_bits / 8).
+ * If the array can't be allocated, every pass relinks the nodes into 256 bucket chains instead.
+ * @param list_ptr [T **] A reference to the list.
+ * @param key [uint64_t (*)(const void *)] Extracts the key of an element, receives a reference to the element.
+ * @param key_bits [unsigned] The number of low bits of the key that are significant, from 1 to 64, the higher bits are ignored.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the key function is NULL.
+ * @throw [assert] If key_bits is not between 1 and 64.
+ */
+void LinkedList_radix_sort(void *list_ptr, uint64_t (*key)(const void *element), unsigned key_bits);
+
+/**
+ * Public
+ * 
+ * Maps a signed integer to a LinkedList_radix_sort key with the same order.
+ * @param value [int64_t] The value, must fit in a signed integer of key_bits bits.
+ * @param key_bits [unsigned] The number of bits of the key, from 1 to 64 (32 for int32_t values, 64 for int64_t values ...).
+ * @return [uint64_t] The key.
+ * @throw [assert] If key_bits is not between 1 and 64.
+ */
+uint64_t LinkedList_radix_key_signed(int64_t value, unsigned key_bits);
+
+/**
+ * Public
+ * 
+ * Maps a float to a 32 bits LinkedList_radix_sort key with the same order, -0.0 comes before 0.0 and NaNs come at the ends.
+ * @param value [float] The value.
+ * @return [uint64_t] The key.
+ */
+uint64_t LinkedList_radix_key_float(float value);
+
+/**
+ * Public
+ * 
+ * Maps a double to a 64 bits LinkedList_radix_sort key with the same order, -0.0 comes before 0.0 and NaNs come at the ends.
+ * @param value [double] The value.
+ * @return [uint64_t] The key.
+ */
+uint64_t LinkedList_radix_key_double(double value);
+
+/**
+ * The default minimum number of elements a parallel operation gives to each task, lists shorter than twice that run on the calling thread.
+ */
+#define LINKEDLIST_EXECUTOR_DEFAULT_CUTOFF 4096
+
+/**
+ * A pool of worker threads, created once and passed to the parallel operations (LinkedList_sort_parallel, LinkedList_par_foreach ...).
+ * Every worker owns a deque of tasks, it runs the newest task of its own deque first and steals the oldest task of another deque when its own is empty.
+ * A thread calling a parallel operation runs the first task itself, then helps by stealing tasks until the operation is done.
+ */
+typedef struct LinkedListExecutor LinkedListExecutor;
+
+/**
+ * The statistics of a worker of an executor.
+ */
+typedef struct LinkedListExecutorStats {
+    size_t tasks_executed;
+    size_t steals; // the tasks taken from the deque of another worker
+} LinkedListExecutorStats;
+
+/**
+ * Public
+ * 
+ * Creates an executor and starts its workers.
+ * @param worker_count [size_t] The number of worker threads, 0 for one per online processor.
+ * @param cutoff [size_t] The minimum number of elements per task, 0 for LINKEDLIST_EXECUTOR_DEFAULT_CUTOFF.
+ * @return [LinkedListExecutor *] The executor.
+ * @throw [assert] If malloc fails.
+ * @throw [assert] If a worker thread can't be created.
+ */
+LinkedListExecutor *LinkedList_executor_init(size_t worker_count, size_t cutoff);
+
+/**
+ * Public
+ * 
+ * Stops the workers of the executor and frees it, no parallel operation may be running on it.
+ * @param executor_ptr [LinkedListExecutor **] A reference to the executor, set to NULL.
+ * @throw [assert] If the reference to the executor is NULL.
+ * @throw [assert] If the executor is NULL.
+ */
+void LinkedList_executor_destroy(LinkedListExecutor **executor_ptr);
+
+/**
+ * Public
+ * 
+ * Gets the number of workers of the executor.
+ * @param executor [const LinkedListExecutor *] The executor.
+ * @return [size_t] The number of workers.
+ * @throw [assert] If the executor is NULL.
+ */
+size_t LinkedList_executor_worker_count(const LinkedListExecutor *executor);
+
+/**
+ * Public
+ * 
+ * Gets the statistics of a worker of the executor, for tuning the cutoff and the number of workers.
+ * @param executor [const LinkedListExecutor *] The executor.
+ * @param worker [size_t] The index of the worker, LinkedList_executor_worker_count(executor) for the tasks run by the threads calling the parallel operations.
+ * @return [LinkedListExecutorStats] The statistics of the worker.
+ * @throw [assert] If the executor is NULL.
+ * @throw [assert] If the index is out of range.
+ */
+LinkedListExecutorStats LinkedList_executor_stats(const LinkedListExecutor *executor, size_t worker);
+
+/**
+ * Public
+ * 
+ * Sorts the list in place with a stable merge sort running on the workers of an executor.
+ * The list is cut into segments of at least the executor's cutoff, the segments are sorted concurrently with LinkedList_sort's natural merge sort,
+ * then merged pairwise, the merges of each round running concurrently.
+ * @param list_ptr [T **] A reference to the list.
+ * @param ordering_comparator [int (*)(const void *, const void *)] The ordering comparator, receives references to the elements like qsort's, must be thread safe.
+ * @param executor [LinkedListExecutor *] The executor, NULL to sort on the calling thread.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the ordering comparator is NULL.
+ */
+void LinkedList_sort_parallel(void *list_ptr, int (*ordering_comparator)(const void *, const void *), LinkedListExecutor *executor);
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Filters the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @return [T *] The filtered list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_filter(__list_ptr__, __filter__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                if ((__filter__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
+                    __Node *__node__ = __node_init(__temp_list__->element_size); \
+                    *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
+                    if (__temp_new_list__->head == NULL) { \
+                        __temp_new_list__->head = __node__; \
+                    } else { \
+                        __temp_new_list__->tail->next = __node__; \
+                        __node__->previous = __temp_new_list__->tail; \
+                    } \
+                    __temp_new_list__->tail = __node__; \
+                    __temp_new_list__->length++; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Filters the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The filtered list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_filter(__list_ptr__, __filter__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                if ((__filter__)(*((__list_element_type__ *)__current_node__->element))) { \
+                    __Node *__node__ = __node_init(__temp_list__->element_size); \
+                    *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
+                    if (__temp_new_list__->head == NULL) { \
+                        __temp_new_list__->head = __node__; \
+                    } else { \
+                        __temp_new_list__->tail->next = __node__; \
+                        __node__->previous = __temp_new_list__->tail; \
+                    } \
+                    __temp_new_list__->tail = __node__; \
+                    __temp_new_list__->length++; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Filters the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @param __result_ptr__ [T **] A reference to the variable to store the filtered list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_filter(__list_ptr__, __filter__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                if ((__filter__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
+                    __Node *__node__ = __node_init(__temp_list__->element_size); \
+                    *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
+                    if (__temp_new_list__->head == NULL) { \
+                        __temp_new_list__->head = __node__; \
+                    } else { \
+                        __temp_new_list__->tail->next = __node__; \
+                        __node__->previous = __temp_new_list__->tail; \
+                    } \
+                    __temp_new_list__->tail = __node__; \
+                    __temp_new_list__->length++; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Filters the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @param __result_ptr__ [T **] A reference to the variable to store the filtered list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_filter(__list_ptr__, __filter__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                if ((__filter__)(*((__list_element_type__ *)__current_node__->element))) { \
+                    __Node *__node__ = __node_init(__temp_list__->element_size); \
+                    *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
+                    if (__temp_new_list__->head == NULL) { \
+                        __temp_new_list__->head = __node__; \
+                    } else { \
+                        __temp_new_list__->tail->next = __node__; \
+                        __node__->previous = __temp_new_list__->tail; \
+                    } \
+                    __temp_new_list__->tail = __node__; \
+                    __temp_new_list__->length++; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+/**
+ * Private
+ * 
+ * Unlinks in a single pass every node whose predicate result equals `__remove_when__`, then frees them in batch.
+ * The relative order of the kept elements is preserved and the cached node is kept if it survives.
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @param __predicate__ [bool (*)(T)] The predicate.
+ * @param __remove_when__ [bool] The predicate result that marks an element for removal.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __removed_count_reference__ [size_t *] A reference to the variable to store the number of removed elements.
+ */
+#define __LinkedList_remove_where__(__list_ptr__, __predicate__, __remove_when__, __list_element_type__, __removed_count_reference__) do { \
+    LinkedList *__where_list__ = (LinkedList *)(*(__list_ptr__)); \
+    __linkedlist_detach(__where_list__); \
+    __Node *__where_cached__ = __where_list__->cached; \
+    __Node *__where_removed__ = NULL; /* chained through next, freed once the pass is over */ \
+    __Node *__where_current__ = __where_list__->head; \
+    size_t __where_kept_count__ = 0; \
+    size_t __where_removed_count__ = 0; \
+    __where_list__->cached = NULL; \
+    while (__where_current__ != NULL) { \
+        __Node *__where_next__ = __where_current__->next; \
+        if ((bool)(__predicate__)(*((__list_element_type__ *)__where_current__->element)) == (__remove_when__)) { \
+            if (__where_current__->previous != NULL) { \
+                __where_current__->previous->next = __where_next__; \
+            } else { \
+                __where_list__->head = __where_next__; \
+            } \
+            if (__where_next__ != NULL) { \
+                __where_next__->previous = __where_current__->previous; \
+            } else { \
+                __where_list__->tail = __where_current__->previous; \
+            } \
+            __where_current__->next = __where_removed__; \
+            __where_removed__ = __where_current__; \
+            __where_removed_count__++; \
+        } else { \
+            if (__where_current__ == __where_cached__) { \
+                __where_list__->cached = __where_current__; \
+                __where_list__->cached_index = __where_kept_count__; \
+            } \
+            __where_kept_count__++; \
+        } \
+        __where_current__ = __where_next__; \
+    } \
+    __where_list__->length -= __where_removed_count__; \
+    __node_free_chain(__where_removed__); \
+    *(__removed_count_reference__) = __where_removed_count__; \
+} while (0)
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Keeps only the elements that satisfy the filter, removing the others in place without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_retain(__list_ptr__, __filter__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __filter__, false, typeof(**(__list_ptr__)), &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Keeps only the elements that satisfy the filter, removing the others in place without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_retain(__list_ptr__, __filter__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __filter__, false, __list_element_type__, &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Keeps only the elements that satisfy the filter, removing the others in place without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_retain(__list_ptr__, __filter__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __filter__, false, typeof(**(__list_ptr__)), &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Keeps only the elements that satisfy the filter, removing the others in place without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __filter__ [bool (*)(T)] The filter.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_retain(__list_ptr__, __filter__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __filter__, false, __list_element_type__, &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes in place the elements that satisfy the predicate without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __predicate__ [bool (*)(T)] The predicate.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_remove_if(__list_ptr__, __predicate__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __predicate__, true, typeof(**(__list_ptr__)), &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Removes in place the elements that satisfy the predicate without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __predicate__ [bool (*)(T)] The predicate.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_remove_if(__list_ptr__, __predicate__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __predicate__, true, __list_element_type__, &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes in place the elements that satisfy the predicate without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __predicate__ [bool (*)(T)] The predicate.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_remove_if(__list_ptr__, __predicate__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __predicate__, true, typeof(**(__list_ptr__)), &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Removes in place the elements that satisfy the predicate without allocating.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __predicate__ [bool (*)(T)] The predicate.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_remove_if(__list_ptr__, __predicate__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_remove_where__(__list_ptr__, __predicate__, true, __list_element_type__, &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #endif
+#endif
+
+/**
+ * Private
+ * 
+ * Removes in place the elements equal to the element kept before them, in a single pass, freeing the removed nodes once the pass is over.
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __removed_count_reference__ [size_t *] A reference to the variable to store the number of removed elements.
+ */
+#define __LinkedList_unique__(__list_ptr__, __boolean_comparator__, __list_element_type__, __removed_count_reference__) do { \
+    LinkedList *__dedup_list__ = (LinkedList *)(*(__list_ptr__)); \
+    __linkedlist_detach(__dedup_list__); \
+    __Node *__dedup_cached__ = __dedup_list__->cached; \
+    __Node *__dedup_removed__ = NULL; /* chained through next, freed once the pass is over */ \
+    size_t __dedup_kept_count__ = 0; \
+    size_t __dedup_removed_count__ = 0; \
+    __dedup_list__->cached = NULL; \
+    __Node *__dedup_kept__ = NULL; \
+    __Node *__dedup_current__ = __dedup_list__->head; \
+    while (__dedup_current__ != NULL) { \
+        __Node *__dedup_next__ = __dedup_current__->next; \
+        if (__dedup_kept__ != NULL && (__boolean_comparator__)(*((__list_element_type__ *)__dedup_kept__->element), *((__list_element_type__ *)__dedup_current__->element))) { \
+            if (__dedup_current__->previous != NULL) { \
+                __dedup_current__->previous->next = __dedup_next__; \
+            } else { \
+                __dedup_list__->head = __dedup_next__; \
+            } \
+            if (__dedup_next__ != NULL) { \
+                __dedup_next__->previous = __dedup_current__->previous; \
+            } else { \
+                __dedup_list__->tail = __dedup_current__->previous; \
+            } \
+            __dedup_current__->next = __dedup_removed__; \
+            __dedup_removed__ = __dedup_current__; \
+            __dedup_removed_count__++; \
+        } else { \
+            if (__dedup_current__ == __dedup_cached__) { \
+                __dedup_list__->cached = __dedup_current__; \
+                __dedup_list__->cached_index = __dedup_kept_count__; \
+            } \
+            __dedup_kept_count__++; \
+            __dedup_kept__ = __dedup_current__; \
+        } \
+        __dedup_current__ = __dedup_next__; \
+    } \
+    __dedup_list__->length -= __dedup_removed_count__; \
+    __node_free_chain(__dedup_removed__); \
+    *(__removed_count_reference__) = __dedup_removed_count__; \
+} while (0)
+
+/**
+ * Private
+ * 
+ * An entry of the open addressing table of LinkedList_dedup_hashed, a kept node and its hash.
+ */
+typedef struct __LinkedListHashEntry {
+    __Node *node;
+    size_t hash;
+} __LinkedListHashEntry;
+
+/**
+ * Private
+ * 
+ * Removes in place the elements equal to an element before them, in a single pass with a temporary open addressing table of the kept nodes (O(n) expected),
+ * freeing the removed nodes once the pass is over.
+ * @param __list_ptr__ [T **] A reference to the list.
+ * @param __hash__ [size_t (*)(T)] The hash function, equal elements must have equal hashes.
+ * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+ * @param __list_element_type__ [type] The type of the elements in the list.
+ * @param __removed_count_reference__ [size_t *] A reference to the variable to store the number of removed elements.
+ * @throw [assert] If malloc fails.
+ */
+#define __LinkedList_dedup_hashed__(__list_ptr__, __hash__, __boolean_comparator__, __list_element_type__, __removed_count_reference__) do { \
+    LinkedList *__dedup_list__ = (LinkedList *)(*(__list_ptr__)); \
+    __linkedlist_detach(__dedup_list__); \
+    __Node *__dedup_cached__ = __dedup_list__->cached; \
+    __Node *__dedup_removed__ = NULL; /* chained through next, freed once the pass is over */ \
+    size_t __dedup_kept_count__ = 0; \
+    size_t __dedup_removed_count__ = 0; \
+    __dedup_list__->cached = NULL; \
+    /* at most half full, so the probe sequences stay short */ \
+    size_t __table_capacity__ = 16; \
+    while (__table_capacity__ < 2 * __dedup_list__->length) { \
+        __table_capacity__ *= 2; \
+    } \
+    __LinkedListHashEntry *__table__ = (__LinkedListHashEntry *)calloc(__table_capacity__, sizeof(__LinkedListHashEntry)); \
+    assert(__table__ != NULL); \
+    __Node *__dedup_current__ = __dedup_list__->head; \
+    while (__dedup_current__ != NULL) { \
+        __Node *__dedup_next__ = __dedup_current__->next; \
+        size_t __element_hash__ = (size_t)(__hash__)(*((__list_element_type__ *)__dedup_current__->element)); \
+        size_t __slot__ = __element_hash__ & (__table_capacity__ - 1); \
+        bool __duplicate__ = false; \
+        while (__table__[__slot__].node != NULL) { \
+            if (__table__[__slot__].hash == __element_hash__ && (__boolean_comparator__)(*((__list_element_type__ *)__table__[__slot__].node->element), *((__list_element_type__ *)__dedup_current__->element))) { \
+                __duplicate__ = true; \
+                break; \
+            } \
+            __slot__ = (__slot__ + 1) & (__table_capacity__ - 1); \
+        } \
+        if (__duplicate__) { \
+            if (__dedup_current__->previous != NULL) { \
+                __dedup_current__->previous->next = __dedup_next__; \
+            } else { \
+                __dedup_list__->head = __dedup_next__; \
+            } \
+            if (__dedup_next__ != NULL) { \
+                __dedup_next__->previous = __dedup_current__->previous; \
+            } else { \
+                __dedup_list__->tail = __dedup_current__->previous; \
+            } \
+            __dedup_current__->next = __dedup_removed__; \
+            __dedup_removed__ = __dedup_current__; \
+            __dedup_removed_count__++; \
+        } else { \
+            __table__[__slot__].node = __dedup_current__; \
+            __table__[__slot__].hash = __element_hash__; \
+            if (__dedup_current__ == __dedup_cached__) { \
+                __dedup_list__->cached = __dedup_current__; \
+                __dedup_list__->cached_index = __dedup_kept_count__; \
+            } \
+            __dedup_kept_count__++; \
+        } \
+        __dedup_current__ = __dedup_next__; \
+    } \
+    free(__table__); \
+    __dedup_list__->length -= __dedup_removed_count__; \
+    __node_free_chain(__dedup_removed__); \
+    *(__removed_count_reference__) = __dedup_removed_count__; \
+} while (0)
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to the element before them (for a sorted list, all the duplicates), keeping the first of every run of equal elements,
+         * in a single pass without allocating, the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_unique(__list_ptr__, __boolean_comparator__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_unique__(__list_ptr__, (__boolean_comparator__), typeof(**(__list_ptr__)), &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to the element before them (for a sorted list, all the duplicates), keeping the first of every run of equal elements,
+         * in a single pass without allocating, the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_unique(__list_ptr__, __boolean_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_unique__(__list_ptr__, (__boolean_comparator__), __list_element_type__, &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to the element before them (for a sorted list, all the duplicates), keeping the first of every run of equal elements,
+         * in a single pass without allocating, the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_unique(__list_ptr__, __boolean_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_unique__(__list_ptr__, (__boolean_comparator__), typeof(**(__list_ptr__)), &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to the element before them (for a sorted list, all the duplicates), keeping the first of every run of equal elements,
+         * in a single pass without allocating, the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_unique(__list_ptr__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_unique__(__list_ptr__, (__boolean_comparator__), __list_element_type__, &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to an element before them, keeping the first occurrence of every element and the order of the list,
+         * in a single pass with a temporary open addressing table (O(n) expected), the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __hash__ [size_t (*)(T)] The hash function, equal elements must have equal hashes.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_dedup_hashed(__list_ptr__, __hash__, __boolean_comparator__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_dedup_hashed__(__list_ptr__, (__hash__), (__boolean_comparator__), typeof(**(__list_ptr__)), &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to an element before them, keeping the first occurrence of every element and the order of the list,
+         * in a single pass with a temporary open addressing table (O(n) expected), the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __hash__ [size_t (*)(T)] The hash function, equal elements must have equal hashes.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [size_t] The number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_dedup_hashed(__list_ptr__, __hash__, __boolean_comparator__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_dedup_hashed__(__list_ptr__, (__hash__), (__boolean_comparator__), __list_element_type__, &__removed_elements__); \
+            __removed_elements__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to an element before them, keeping the first occurrence of every element and the order of the list,
+         * in a single pass with a temporary open addressing table (O(n) expected), the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __hash__ [size_t (*)(T)] The hash function, equal elements must have equal hashes.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_dedup_hashed(__list_ptr__, __hash__, __boolean_comparator__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_dedup_hashed__(__list_ptr__, (__hash__), (__boolean_comparator__), typeof(**(__list_ptr__)), &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Removes in place the elements equal to an element before them, keeping the first occurrence of every element and the order of the list,
+         * in a single pass with a temporary open addressing table (O(n) expected), the removed nodes get freed together once the pass is over.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __hash__ [size_t (*)(T)] The hash function, equal elements must have equal hashes.
+         * @param __boolean_comparator__ [bool (*)(T, T)] The boolean comparator.
+         * @param __result_ptr__ [size_t *] A reference to the variable to store the number of removed elements.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_dedup_hashed(__list_ptr__, __hash__, __boolean_comparator__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            size_t __removed_elements__ = 0; \
+            __LinkedList_dedup_hashed__(__list_ptr__, (__hash__), (__boolean_comparator__), __list_element_type__, &__removed_elements__); \
+            *(__result_ptr__) = __removed_elements__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_TYPEOF
+    /**
+     * Public
+     * 
+     * Executes a function for each element in the list.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __func__ [void (*)(T)] The function to execute.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     */
+    #define LinkedList_foreach(__list_ptr__, __func__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        __Node *__current_node__ = __temp_list__->head; \
+        while (__current_node__ != NULL) { \
+            (__func__)((typeof(**(__list_ptr__)) *)__current_node__->element); \
+            __current_node__ = __current_node__->next; \
+        } \
+    } while(0)
+#else
+    /**
+     * Public
+     * 
+     * Executes a function for each element in the list.
+     * @param __list_ptr__ [T **] A reference to the list.
+     * @param __func__ [void (*)(T)] The function to execute.
+     * @param __list_element_type__ [type] The type of the elements in the list.
+     * @throw [assert] If the reference to the list is NULL.
+     * @throw [assert] If the list is NULL.
+     */
+    #define LinkedList_foreach(__list_ptr__, __func__, __list_element_type__) do { \
+        assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+        LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+        __linkedlist_detach(__temp_list__); \
+        __Node *__current_node__ = __temp_list__->head; \
+        while (__current_node__ != NULL) { \
+            (__func__)((__list_element_type__ *)__current_node__->element); \
+            __current_node__ = __current_node__->next; \
+        } \
+    } while(0)
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Maps the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __mapper__ [U (*)(T)] The mapper.
+         * @return [U *] The mapped list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_map(__list_ptr__, __mapper__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((typeof(**(__list_ptr__)) *)__node__->element) = (__mapper__)(*((typeof(**(__list_ptr__)) *)__current_node__->element)); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Maps the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __mapper__ [U (*)(T)] The mapper.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [U *] The mapped list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         */
+        #define LinkedList_map(__list_ptr__, __mapper__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((__list_element_type__ *)__node__->element) = (__mapper__)(*((__list_element_type__ *)__current_node__->element)); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Maps the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __mapper__ [U (*)(T)] The mapper.
+         * @param __result_ptr__ [T **] A reference to the variable to store the mapped list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_map(__list_ptr__, __mapper__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((typeof(**(__list_ptr__)) *)__node__->element) = (__mapper__)(*((typeof(**(__list_ptr__)) *)__current_node__->element)); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Maps the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __mapper__ [U (*)(T)] The mapper.
+         * @param __result_ptr__ [T **] A reference to the variable to store the mapped list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If malloc fails.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_map(__list_ptr__, __mapper__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((__list_element_type__ *)__node__->element) = (__mapper__)(*((__list_element_type__ *)__current_node__->element)); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Reduces the list to a single value.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __reducer__ [U (*)(U, T)] The reducer.
+         * @param __initial_value__ [U] The initial value.
+         * @return [U] The reduced value.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(__initial_value__) __accumulator__ = (__initial_value__); \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __accumulator__ = (__reducer__)(__accumulator__, *((typeof(**(__list_ptr__)) *)__current_node__->element)); \
+                __current_node__ = __current_node__->next; \
+            } \
+            __accumulator__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Reduces the list to a single value.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __reducer__ [U (*)(U, T)] The reducer.
+         * @param __initial_value__ [U] The initial value.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [U] The reduced value.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ __accumulator__ = (__initial_value__); \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __accumulator__ = (__reducer__)(__accumulator__, *((__list_element_type__ *)__current_node__->element)); \
+                __current_node__ = __current_node__->next; \
+            } \
+            __accumulator__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Reduces the list to a single value.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __reducer__ [U (*)(U, T)] The reducer.
+         * @param __initial_value__ [U] The initial value.
+         * @param __result_ptr__ [U *] A reference to the variable to store the reduced value.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            typeof(__initial_value__) __accumulator__ = (__initial_value__); \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __accumulator__ = (__reducer__)(__accumulator__, *((typeof(**(__list_ptr__)) *)__current_node__->element)); \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __accumulator__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Reduces the list to a single value.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __reducer__ [U (*)(U, T)] The reducer.
+         * @param __initial_value__ [U] The initial value.
+         * @param __result_ptr__ [U *] A reference to the variable to store the reduced value.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_reduce(__list_ptr__, __reducer__, __initial_value__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __list_element_type__ __accumulator__ = (__initial_value__); \
+            __Node *__current_node__ = __temp_list__->head; \
+            while (__current_node__ != NULL) { \
+                __accumulator__ = (__reducer__)(__accumulator__, *((__list_element_type__ *)__current_node__->element)); \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __accumulator__; \
+        } while(0)
+    #endif
+#endif
+
+/**
+ * Public
+ * 
+ * Executes a function for each element in the list, on the workers of an executor.
+ * The list is cut into segments of at least the executor's cutoff with a single walk, the segments are processed concurrently.
+ * @param list_ptr [T **] A reference to the list.
+ * @param func [void (*)(void *, void *)] The function to execute, receives a reference to the element and the context, must be thread safe.
+ * @param context [void *] Passed to every call of the function.
+ * @param executor [LinkedListExecutor *] The executor, NULL to run on the calling thread.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the function is NULL.
+ */
+void LinkedList_par_foreach(void *list_ptr, void (*func)(void *element, void *context), void *context, LinkedListExecutor *executor);
+
+/**
+ * Public
+ * 
+ * Maps the list on the workers of an executor, every task builds the chain of its segment and the chains are linked together, nothing gets copied.
+ * @param list_ptr [T **] A reference to the list.
+ * @param mapper [void (*)(const void *, void *)] The mapper, receives a reference to the element and writes the result to the second reference, must be thread safe.
+ * @param result_size [size_t] The size of the results.
+ * @param executor [LinkedListExecutor *] The executor, NULL to run on the calling thread.
+ * @return [U *] The mapped list.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the mapper is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void *LinkedList_par_map(void *list_ptr, void (*mapper)(const void *element, void *result), size_t result_size, LinkedListExecutor *executor);
+
+/**
+ * Public
+ * 
+ * Reduces the list to a single value on the workers of an executor.
+ * Every segment is reduced into an accumulator of its own starting from a copy of the initial value, the accumulators are then combined in the list's order,
+ * so the initial value must be the identity of the combiner (0 for a sum, 1 for a product ...), and both the reducer and the combiner must be associative.
+ * @param list_ptr [T **] A reference to the list.
+ * @param reducer [void (*)(void *, const void *)] The reducer, receives the accumulator and a reference to the element, must be thread safe.
+ * @param combiner [void (*)(void *, const void *)] Combines the accumulator of the next segment into the first one.
+ * @param accumulator [void *] The initial value, receives the reduced value.
+ * @param accumulator_size [size_t] The size of the accumulator.
+ * @param executor [LinkedListExecutor *] The executor, NULL to run on the calling thread.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the reducer, the combiner or the accumulator is NULL.
+ */
+void LinkedList_par_reduce(void *list_ptr, void (*reducer)(void *accumulator, const void *element), void (*combiner)(void *accumulator, const void *other_accumulator), void *accumulator, size_t accumulator_size, LinkedListExecutor *executor);
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Checks if any element in the list satisfies the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @return [bool] True if any element satisfies the condition, false otherwise.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_any(__list_ptr__, __func__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = false; \
+            while (__current_node__ != NULL) { \
+                if ((__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
+                    __result__ = true; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            __result__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Checks if any element in the list satisfies the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [bool] True if any element satisfies the condition, false otherwise.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_any(__list_ptr__, __func__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = false; \
+            while (__current_node__ != NULL) { \
+                if ((__func__)(*((__list_element_type__ *)__current_node__->element))) { \
+                    __result__ = true; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            __result__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Checks if any element in the list satisfies the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_any(__list_ptr__, __func__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = false; \
+            while (__current_node__ != NULL) { \
+                if ((__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
+                    __result__ = true; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __result__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Checks if any element in the list satisfies the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_any(__list_ptr__, __func__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = false; \
+            while (__current_node__ != NULL) { \
+                if ((__func__)(*((__list_element_type__ *)__current_node__->element))) { \
+                    __result__ = true; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __result__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Checks if all elements in the list satisfy the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @return [bool] True if all elements satisfy the condition, false otherwise.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_all(__list_ptr__, __func__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = true; \
+            while (__current_node__ != NULL) { \
+                if (!(__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
+                    __result__ = false; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            __result__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Checks if all elements in the list satisfy the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [bool] True if all elements satisfy the condition, false otherwise.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         */
+        #define LinkedList_all(__list_ptr__, __func__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = true; \
+            while (__current_node__ != NULL) { \
+                if (!(__func__)(*((__list_element_type__ *)__current_node__->element))) { \
+                    __result__ = false; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            __result__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Checks if all elements in the list satisfy the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_all(__list_ptr__, __func__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = true; \
+            while (__current_node__ != NULL) { \
+                if (!(__func__)(*((typeof(**(__list_ptr__)) *)__current_node__->element))) { \
+                    __result__ = false; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __result__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Checks if all elements in the list satisfy the condition.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __func__ [bool (*)(T)] The condition.
+         * @param __result_ptr__ [bool *] A reference to the variable to store the result.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_all(__list_ptr__, __func__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            __Node *__current_node__ = __temp_list__->head; \
+            bool __result__ = true; \
+            while (__current_node__ != NULL) { \
+                if (!(__func__)(*((__list_element_type__ *)__current_node__->element))) { \
+                    __result__ = false; \
+                    break; \
+                } \
+                __current_node__ = __current_node__->next; \
+            } \
+            *(__result_ptr__) = __result__; \
+        } while(0)
+    #endif
+#endif
+
+#if COMPILER_SUPPORTS_STATEMENT_EXPRESSIONS
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Slices the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The start index.
+         * @param __end__ [size_t] The end index.
+         * @param __step__ [size_t] The step.
+         * @return [T *] The sliced list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the start index is out of bounds.
+         * @throw [assert] If the end index is out of bounds.
+         * @throw [assert] If the start index is greater than or equal to the end index.
+         * @throw [assert] If the step is less than or equal to 0.
+         */
+        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
+            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
+            assert(__start__ < __end__); \
+            assert(__step__ > 0); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __linkedlist_node_at(__list_ptr__, __start__); \
+            size_t __i__ = __start__; \
+            while (__i__ < __end__) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
+                    __current_node__ = __current_node__->next; \
+                    __i__++; \
+                    if (__i__ >= __end__) { \
+                        break; \
+                    } \
+                } \
+            } \
+            __new_list__; \
+        })
+    #else
+        /**
+         * Public
+         * 
+         * Slices the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The start index.
+         * @param __end__ [size_t] The end index.
+         * @param __step__ [size_t] The step.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @return [T *] The sliced list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the start index is out of bounds.
+         * @throw [assert] If the end index is out of bounds.
+         * @throw [assert] If the start index is greater than or equal to the end index.
+         * @throw [assert] If the step is less than or equal to 0.
+         */
+        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__, __list_element_type__) ({ \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
+            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
+            assert(__start__ < __end__); \
+            assert(__step__ > 0); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __linkedlist_node_at(__list_ptr__, __start__); \
+            size_t __i__ = __start__; \
+            while (__i__ < __end__) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
+                    __current_node__ = __current_node__->next; \
+                    __i__++; \
+                    if (__i__ >= __end__) { \
+                        break; \
+                    } \
+                } \
+            } \
+            __new_list__; \
+        })
+    #endif
+#else
+    #if COMPILER_SUPPORTS_TYPEOF
+        /**
+         * Public
+         * 
+         * Slices the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The start index.
+         * @param __end__ [size_t] The end index.
+         * @param __step__ [size_t] The step.
+         * @param __result_ptr__ [T **] A reference to the variable to store the sliced list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the start index is out of bounds.
+         * @throw [assert] If the end index is out of bounds.
+         * @throw [assert] If the start index is greater than or equal to the end index.
+         * @throw [assert] If the step is less than or equal to 0.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__, __result_ptr__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
+            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
+            assert(__start__ < __end__); \
+            assert(__step__ > 0); \
+            typeof(**(__list_ptr__)) *__new_list__ = LinkedList_init(typeof(**(__list_ptr__))); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __linkedlist_node_at(__list_ptr__, __start__); \
+            size_t __i__ = __start__; \
+            while (__i__ < __end__) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((typeof(**(__list_ptr__)) *)__node__->element) = *((typeof(**(__list_ptr__)) *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
+                    __current_node__ = __current_node__->next; \
+                    __i__++; \
+                    if (__i__ >= __end__) { \
+                        break; \
+                    } \
+                } \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #else
+        /**
+         * Public
+         * 
+         * Slices the list.
+         * @param __list_ptr__ [T **] A reference to the list.
+         * @param __start__ [size_t] The start index.
+         * @param __end__ [size_t] The end index.
+         * @param __step__ [size_t] The step.
+         * @param __result_ptr__ [T **] A reference to the variable to store the sliced list.
+         * @param __list_element_type__ [type] The type of the elements in the list.
+         * @throw [assert] If the reference to the list is NULL.
+         * @throw [assert] If the list is NULL.
+         * @throw [assert] If the start index is out of bounds.
+         * @throw [assert] If the end index is out of bounds.
+         * @throw [assert] If the start index is greater than or equal to the end index.
+         * @throw [assert] If the step is less than or equal to 0.
+         * @throw [assert] If the result pointer is NULL.
+         */
+        #define LinkedList_slice(__list_ptr__, __start__, __end__, __step__, __result_ptr__, __list_element_type__) do { \
+            assert(((__list_ptr__) != NULL) && (*(__list_ptr__) != NULL)); \
+            assert((__result_ptr__) != NULL); \
+            LinkedList *__temp_list__ = (LinkedList *)(*(__list_ptr__)); \
+            assert((__start__ >= 0) && (__start__ < __temp_list__->length)); \
+            assert((__end__ >= 0) && (__end__ <= __temp_list__->length)); \
+            assert(__start__ < __end__); \
+            assert(__step__ > 0); \
+            __list_element_type__ *__new_list__ = LinkedList_init(__list_element_type__); \
+            LinkedList *__temp_new_list__ = (LinkedList *)__new_list__; \
+            __Node *__current_node__ = __linkedlist_node_at(__list_ptr__, __start__); \
+            size_t __i__ = __start__; \
+            while (__i__ < __end__) { \
+                __Node *__node__ = __node_init(__temp_list__->element_size); \
+                *((__list_element_type__ *)__node__->element) = *((__list_element_type__ *)__current_node__->element); \
+                if (__temp_new_list__->head == NULL) { \
+                    __temp_new_list__->head = __node__; \
+                } else { \
+                    __temp_new_list__->tail->next = __node__; \
+                    __node__->previous = __temp_new_list__->tail; \
+                } \
+                __temp_new_list__->tail = __node__; \
+                __temp_new_list__->length++; \
+                for (size_t __j__ = 0; __j__ < __step__; __j__++) { \
+                    __current_node__ = __current_node__->next; \
+                    __i__++; \
+                    if (__i__ >= __end__) { \
+                        break; \
+                    } \
+                } \
+            } \
+            *(__result_ptr__) = __new_list__; \
+        } while(0)
+    #endif
+#endif
+
+
+/**
+ * Public
+ * 
+ * The maximum number of stages a view can chain.
+ */
+#define LINKEDLIST_VIEW_MAX_STAGES 16
+
+typedef enum __LinkedListViewStageKind {
+    __LINKEDLIST_VIEW_FILTER,
+    __LINKEDLIST_VIEW_MAP,
+    __LINKEDLIST_VIEW_TAKE,
+    __LINKEDLIST_VIEW_SKIP,
+} __LinkedListViewStageKind;
+
+typedef struct __LinkedListViewStage {
+    __LinkedListViewStageKind kind;
+    bool (*filter)(const void *element);
+    void (*mapper)(const void *element, void *result);
+    size_t count;        // the number of elements taken or skipped
+    size_t result_size;  // the size of the elements produced by a map stage
+} __LinkedListViewStage;
+
+/**
+ * A lazy, non-owning pipeline over a list.
+ * Stages are only recorded when chained, they all run fused in a single traversal when a terminal operation
+ * (count, foreach, reduce, collect, to_array) is called, so no intermediate list is ever built.
+ * The view references the list, it must not outlive it, and the list must not be modified while a terminal operation runs.
+ * A slice view also references the nodes of its slice, so it must not be used after the list is modified.
+ * The callbacks receive references to the elements because the element type of each stage is only known at runtime.
+ */
+typedef struct LinkedListView {
+    LinkedList *list;
+    __Node *first;         // the first node of a slice view, NULL when the view covers the whole list
+    size_t source_length;  // the number of nodes of a slice view
+    ptrdiff_t step;        // the distance between two nodes of a slice view, negative to walk backward
+    __LinkedListViewStage stages[LINKEDLIST_VIEW_MAX_STAGES];
+    size_t stage_count;
+    size_t element_size; // the size of the elements produced by the view
+} LinkedListView;
+
+/**
+ * Public
+ * 
+ * Creates a view over the list.
+ * @param list_ptr [T **] A reference to the list.
+ * @return [LinkedListView] The view, with no stages.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ */
+LinkedListView LinkedList_view(void *list_ptr);
+
+/**
+ * Public
+ * 
+ * Creates a view over a slice of the list without copying (nor allocating) anything.
+ * With a positive step the slice holds the indexes start, start + step, ... lower than end,
+ * with a negative step it holds the indexes start, start + step, ... greater than end and is walked backward.
+ * The first node is reached from the nearest of the head, the tail and the cached node.
+ * @param list_ptr [T **] A reference to the list.
+ * @param start [ptrdiff_t] The index of the first element.
+ * @param end [ptrdiff_t] The index where the slice stops (excluded), -1 to walk backward down to the head.
+ * @param step [ptrdiff_t] The step.
+ * @return [LinkedListView] The view, with no stages.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the step is 0.
+ * @throw [assert] If the start or the end index is out of bounds.
+ */
+LinkedListView LinkedList_slice_view(void *list_ptr, ptrdiff_t start, ptrdiff_t end, ptrdiff_t step);
+
+/**
+ * Public
+ * 
+ * Appends a filter stage to the view.
+ * @param view [LinkedListView *] A reference to the view.
+ * @param filter [bool (*)(const T *)] The filter, the elements for which it returns false are dropped.
+ * @return [LinkedListView *] The view, to chain more stages.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If the filter is NULL.
+ * @throw [assert] If the view already has LINKEDLIST_VIEW_MAX_STAGES stages.
+ */
+LinkedListView *LinkedList_view_filter(LinkedListView *view, bool (*filter)(const void *element));
+
+/**
+ * Public
+ * 
+ * Appends a map stage to the view.
+ * @param view [LinkedListView *] A reference to the view.
+ * @param mapper [void (*)(const T *, U *)] The mapper, writes the mapped value of the element into the result.
+ * @param result_size [size_t] The size of the mapped values (sizeof(U)).
+ * @return [LinkedListView *] The view, to chain more stages.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If the mapper is NULL.
+ * @throw [assert] If the result size is 0.
+ * @throw [assert] If the view already has LINKEDLIST_VIEW_MAX_STAGES stages.
+ */
+LinkedListView *LinkedList_view_map(LinkedListView *view, void (*mapper)(const void *element, void *result), size_t result_size);
+
+/**
+ * Public
+ * 
+ * Appends a stage that lets through at most `count` elements, the traversal stops as soon as it is exhausted.
+ * @param view [LinkedListView *] A reference to the view.
+ * @param count [size_t] The number of elements to take.
+ * @return [LinkedListView *] The view, to chain more stages.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If the view already has LINKEDLIST_VIEW_MAX_STAGES stages.
+ */
+LinkedListView *LinkedList_view_take(LinkedListView *view, size_t count);
+
+/**
+ * Public
+ * 
+ * Appends a stage that drops the first `count` elements reaching it.
+ * @param view [LinkedListView *] A reference to the view.
+ * @param count [size_t] The number of elements to skip.
+ * @return [LinkedListView *] The view, to chain more stages.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If the view already has LINKEDLIST_VIEW_MAX_STAGES stages.
+ */
+LinkedListView *LinkedList_view_skip(LinkedListView *view, size_t count);
+
+/**
+ * Public
+ * 
+ * Counts the elements produced by the view.
+ * @param view [const LinkedListView *] A reference to the view.
+ * @return [size_t] The number of elements produced by the view.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If malloc fails.
+ */
+size_t LinkedList_view_count(const LinkedListView *view);
+
+/**
+ * Public
+ * 
+ * Executes a function for each element produced by the view.
+ * @param view [const LinkedListView *] A reference to the view.
+ * @param func [void (*)(const U *, void *)] The function to execute, receives the element and the context.
+ * @param context [void *] A value passed as is to the function, may be NULL.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If the function is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void LinkedList_view_foreach(const LinkedListView *view, void (*func)(const void *element, void *context), void *context);
+
+/**
+ * Public
+ * 
+ * Reduces the elements produced by the view into the accumulator.
+ * @param view [const LinkedListView *] A reference to the view.
+ * @param reducer [void (*)(A *, const U *)] The reducer, updates the accumulator with the element.
+ * @param accumulator [A *] A reference to the accumulator, holding the initial value.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If the reducer is NULL.
+ * @throw [assert] If the accumulator is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void LinkedList_view_reduce(const LinkedListView *view, void (*reducer)(void *accumulator, const void *element), void *accumulator);
+
+/**
+ * Public
+ * 
+ * Collects the elements produced by the view into a new list, this is the only operation of the view that allocates nodes.
+ * @param view [const LinkedListView *] A reference to the view.
+ * @return [U *] The new list.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void *LinkedList_view_collect(const LinkedListView *view);
+
+/**
+ * Public
+ * 
+ * Copies the elements produced by the view into a contiguous array.
+ * @param view [const LinkedListView *] A reference to the view.
+ * @param array [U *] The array, large enough to hold LinkedList_view_count(view) elements.
+ * @return [size_t] The number of elements copied.
+ * @throw [assert] If the view is NULL.
+ * @throw [assert] If the array is NULL.
+ * @throw [assert] If malloc fails.
+ */
+size_t LinkedList_view_to_array(const LinkedListView *view, void *array);
+
+/**
+ * A list that can be shared between threads without an outer lock, created with LinkedList_init_concurrent and used only through the LinkedList_concurrent_* functions.
+ * Every node has its own read-write lock and the operations walk from the head hand-over-hand (locking the next node before releasing the current one),
+ * so operations on different parts of the list run in parallel, and the readers (get, find, foreach) only take read locks and keep no cached node.
+ * The operations on the back (push, pop) start from the tail instead of walking the list.
+ */
+typedef struct LinkedListConcurrent LinkedListConcurrent;
+
+/**
+ * Private
+ * 
+ * Initializes a new concurrent list.
+ * @param element_size [size_t] The size of the elements in the list.
+ * @return [LinkedListConcurrent *] The new list.
+ * @throw [assert] If malloc fails.
+ */
+LinkedListConcurrent *__linkedlist_init_concurrent(size_t element_size);
+
+/**
+ * Public
+ * 
+ * Initializes a new concurrent list.
+ * @param __T__ [type] The type of the elements in the list.
+ * @return [LinkedListConcurrent *] The new list.
+ * @throw [assert] If malloc fails.
+ */
+#define LinkedList_init_concurrent(__T__) __linkedlist_init_concurrent(sizeof(__T__))
+
+/**
+ * Public
+ * 
+ * Frees the concurrent list and its nodes, no other thread may be using it.
+ * @param list_ptr [LinkedListConcurrent **] A reference to the list, set to NULL.
+ * @throw [assert] If the reference to the list is NULL.
+ * @throw [assert] If the list is NULL.
+ */
+void LinkedList_concurrent_destroy(LinkedListConcurrent **list_ptr);
+
+/**
+ * Public
+ * 
+ * Gets the length of the concurrent list, other threads may change it right after.
+ * @param list [LinkedListConcurrent *] The list.
+ * @return [size_t] The length of the list.
+ * @throw [assert] If the list is NULL.
+ */
+size_t LinkedList_concurrent_length(const LinkedListConcurrent *list);
+
+/**
+ * Public
+ * 
+ * Inserts a copy of the referenced element at the specified index of the concurrent list.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param index [size_t] The index to insert the element at.
+ * @param element [const T *] A reference to the element.
+ * @return [bool] Whether the element was inserted, false if the index was past the length of the list when it was reached.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the element is NULL.
+ * @throw [assert] If malloc fails.
+ */
+bool LinkedList_concurrent_insert_at(LinkedListConcurrent *list, size_t index, const void *element);
+
+/**
+ * Public
+ * 
+ * Pushes a copy of the referenced element to the front of the concurrent list.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param element [const T *] A reference to the element.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the element is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void LinkedList_concurrent_push_front(LinkedListConcurrent *list, const void *element);
+
+/**
+ * Public
+ * 
+ * Pushes a copy of the referenced element to the end of the concurrent list, without walking it.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param element [const T *] A reference to the element.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the element is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void LinkedList_concurrent_push(LinkedListConcurrent *list, const void *element);
+
+/**
+ * Public
+ * 
+ * Copies the element at the specified index of the concurrent list, taking only read locks.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param index [size_t] The index of the element.
+ * @param element [T *] A reference to the variable to store the element.
+ * @return [bool] Whether the element was copied, false if the index was out of bounds when it was reached.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the element is NULL.
+ */
+bool LinkedList_concurrent_get(LinkedListConcurrent *list, size_t index, void *element);
+
+/**
+ * Public
+ * 
+ * Sets the element at the specified index of the concurrent list to a copy of the referenced element.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param index [size_t] The index of the element.
+ * @param element [const T *] A reference to the new element.
+ * @return [bool] Whether the element was set, false if the index was out of bounds when it was reached.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the element is NULL.
+ */
+bool LinkedList_concurrent_set(LinkedListConcurrent *list, size_t index, const void *element);
+
+/**
+ * Public
+ * 
+ * Removes the element at the specified index of the concurrent list.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param index [size_t] The index of the element.
+ * @param element [T *] A reference to the variable to store the removed element, if NULL the element is discarded.
+ * @return [bool] Whether an element was removed, false if the index was out of bounds when it was reached.
+ * @throw [assert] If the list is NULL.
+ */
+bool LinkedList_concurrent_remove_at(LinkedListConcurrent *list, size_t index, void *element);
+
+/**
+ * Public
+ * 
+ * Removes the first element of the concurrent list.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param element [T *] A reference to the variable to store the removed element, if NULL the element is discarded.
+ * @return [bool] Whether an element was removed, false if the list was empty.
+ * @throw [assert] If the list is NULL.
+ */
+bool LinkedList_concurrent_pop_front(LinkedListConcurrent *list, void *element);
+
+/**
+ * Public
+ * 
+ * Removes the last element of the concurrent list, without walking it.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param element [T *] A reference to the variable to store the removed element, if NULL the element is discarded.
+ * @return [bool] Whether an element was removed, false if the list was empty.
+ * @throw [assert] If the list is NULL.
+ */
+bool LinkedList_concurrent_pop(LinkedListConcurrent *list, void *element);
+
+/**
+ * Public
+ * 
+ * Gets the index of the first element of the concurrent list that satisfies the boolean comparator, taking only read locks.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param value [const T *] A reference to the value to search for.
+ * @param boolean_comparator [bool (*)(const T *, const T *)] The boolean comparator, receives the element and the value, must be thread safe.
+ * @return [size_t] The index of the element, or LINKEDLIST_NOT_FOUND.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the boolean comparator is NULL.
+ */
+size_t LinkedList_concurrent_find(LinkedListConcurrent *list, const void *value, bool (*boolean_comparator)(const void *element, const void *value));
+
+/**
+ * Public
+ * 
+ * Removes the first element of the concurrent list that satisfies the boolean comparator.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param value [const T *] A reference to the value to search for.
+ * @param boolean_comparator [bool (*)(const T *, const T *)] The boolean comparator, receives the element and the value, must be thread safe.
+ * @return [size_t] The index the removed element was at, or LINKEDLIST_NOT_FOUND.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the boolean comparator is NULL.
+ */
+size_t LinkedList_concurrent_remove_value(LinkedListConcurrent *list, const void *value, bool (*boolean_comparator)(const void *element, const void *value));
+
+/**
+ * Public
+ * 
+ * Calls a function on every element of the concurrent list in order, taking only read locks.
+ * Every element is read locked while the function runs, so the function must not call a writing operation on the same list.
+ * @param list [LinkedListConcurrent *] The list.
+ * @param func [void (*)(const T *, void *)] The function, receives the element and the context.
+ * @param context [void *] The context passed to the function.
+ * @throw [assert] If the list is NULL.
+ * @throw [assert] If the function is NULL.
+ */
+void LinkedList_concurrent_foreach(LinkedListConcurrent *list, void (*func)(const void *element, void *context), void *context);
+
+/**
+ * A lock-free multi-producer single-consumer queue of __Node, created with LinkedList_init_mpsc and used only through the LinkedList_mpsc_* functions.
+ * Any number of threads can push concurrently, a push never waits on another thread (one atomic exchange and one store),
+ * but only one thread at a time may pop.
+ */
+typedef struct LinkedListMPSC LinkedListMPSC;
+
+/**
+ * Private
+ * 
+ * Initializes a new multi-producer single-consumer queue.
+ * @param element_size [size_t] The size of the elements in the queue.
+ * @return [LinkedListMPSC *] The new queue.
+ * @throw [assert] If malloc fails.
+ */
+LinkedListMPSC *__linkedlist_init_mpsc(size_t element_size);
+
+/**
+ * Public
+ * 
+ * Initializes a new multi-producer single-consumer queue.
+ * @param __T__ [type] The type of the elements in the queue.
+ * @return [LinkedListMPSC *] The new queue.
+ * @throw [assert] If malloc fails.
+ */
+#define LinkedList_init_mpsc(__T__) __linkedlist_init_mpsc(sizeof(__T__))
+
+/**
+ * Public
+ * 
+ * Frees the queue and the elements left in it, no other thread may be using it.
+ * @param queue_ptr [LinkedListMPSC **] A reference to the queue, set to NULL.
+ * @throw [assert] If the reference to the queue is NULL.
+ * @throw [assert] If the queue is NULL.
+ */
+void LinkedList_mpsc_destroy(LinkedListMPSC **queue_ptr);
+
+/**
+ * Public
+ * 
+ * Pushes a copy of the referenced element to the end of the queue, from any thread.
+ * @param queue [LinkedListMPSC *] The queue.
+ * @param element [const T *] A reference to the element.
+ * @throw [assert] If the queue is NULL.
+ * @throw [assert] If the element is NULL.
+ * @throw [assert] If malloc fails.
+ */
+void LinkedList_mpsc_push(LinkedListMPSC *queue, const void *element);
+
+/**
+ * Public
+ * 
+ * Removes the first element of the queue, from the consumer thread only.
+ * An element whose push has not finished linking its node is not visible yet, the queue then looks empty up to it.
+ * @param queue [LinkedListMPSC *] The queue.
+ * @param element [T *] A reference to the variable to store the removed element, if NULL the element is discarded.
+ * @return [bool] Whether an element was removed, false if the queue was empty.
+ * @throw [assert] If the queue is NULL.
+ */
+bool LinkedList_mpsc_pop(LinkedListMPSC *queue, void *element);
+
+/**
+ * Public
+ * 
+ * Removes up to count elements from the front of the queue into an array, from the consumer thread only, to drain it in bulk.
+ * @param queue [LinkedListMPSC *] The queue.
+ * @param count [size_t] The maximum number of elements to remove.
+ * @param elements [T *] The array to copy the removed elements into, in order, if NULL the elements are discarded.
+ * @return [size_t] The number of removed elements.
+ * @throw [assert] If the queue is NULL.
+ */
+size_t LinkedList_mpsc_pop_batch(LinkedListMPSC *queue, size_t count, void *elements);
+
+/**
+ * A lock-free sorted set, created with LinkedList_init_lockfree and used only through the LinkedList_lockfree_* functions, from any number of threads.
+ * It is a Harris-Michael list: a removal first marks the node as deleted (in the low bit of its next link, so no insertion can link after it),
+ * then unlinks it, and the traversals unlink the deleted nodes they meet. The unlinked nodes are freed with epoch based reclamation,
+ * once every thread that could still be reading them has finished its operation. Each set keeps one small record per thread id that used it,
+ * taken over by a new thread that gets the id of an exited one and freed with the set, so any number of sets can exist at once.
+ */
+typedef struct LinkedListLockFree LinkedListLockFree;
+
+/**
+ * Private
+ * 
+ * Initializes a new lock-free sorted set.
+ * @param element_size [size_t] The size of the elements in the set.
+ * @param ordering_comparator [int (*)(const void *, const void *)] The ordering comparator, receives references to the elements like qsort's, must be thread safe.
+ * @return [LinkedListLockFree *] The new set.
+ * @throw [assert] If the ordering comparator is NULL.
+ * @throw [assert] If malloc fails.
+ */
+LinkedListLockFree *__linkedlist_init_lockfree(size_t element_size, int (*ordering_comparator)(const void *, const void *));
+
+/**
+ * Public
+ * 
+ * Initializes a new lock-free sorted set, the elements are kept in the order of the comparator and the elements it finds equal are not repeated.
+ * @param __T__ [type] The type of the elements in the set.
+ * @param __ordering_comparator__ [int (*)(const void *, const void *)] The ordering comparator, receives references to the elements like qsort's, must be thread safe.
+ * @return [LinkedListLockFree *] The new set.
+ * @throw [assert] If the ordering comparator is NULL.
+ * @throw [assert] If malloc fails.
+ */
+#define LinkedList_init_lockfree(__T__, __ordering_comparator__) __linkedlist_init_lockfree(sizeof(__T__), (__ordering_comparator__))
+
+/**
+ * Public
+ * 
+ * Frees the set and its nodes, no other thread may be using it.
+ * @param list_ptr [LinkedListLockFree **] A reference to the set, set to NULL.
+ * @throw [assert] If the reference to the set is NULL.
+ * @throw [assert] If the set is NULL.
+ */
+void LinkedList_lockfree_destroy(LinkedListLockFree **list_ptr);
+
+/**
+ * Public
+ * 
+ * Gets the number of elements of the set, other threads may change it right after.
+ * @param list [const LinkedListLockFree *] The set.
+ * @return [size_t] The number of elements.
+ * @throw [assert] If the set is NULL.
+ */
+size_t LinkedList_lockfree_length(const LinkedListLockFree *list);
+
+/**
+ * Public
+ * 
+ * Inserts a copy of the referenced element in its sorted position, unless an equal element is already in the set.
+ * @param list [LinkedListLockFree *] The set.
+ * @param element [const T *] A reference to the element.
+ * @return [bool] Whether the element was inserted.
+ * @throw [assert] If the set is NULL.
+ * @throw [assert] If the element is NULL.
+ * @throw [assert] If malloc fails.
+ */
+bool LinkedList_lockfree_insert_sorted(LinkedListLockFree *list, const void *element);
+
+/**
+ * Public
+ * 
+ * Removes the element equal to the referenced value.
+ * @param list [LinkedListLockFree *] The set.
+ * @param value [const T *] A reference to the value to remove.
+ * @param element [T *] A reference to the variable to store the removed element, if NULL the element is discarded.
+ * @return [bool] Whether an element was removed.
+ * @throw [assert] If the set is NULL.
+ * @throw [assert] If the value is NULL.
+ */
+bool LinkedList_lockfree_remove_value(LinkedListLockFree *list, const void *value, void *element);
+
+/**
+ * Public
+ * 
+ * Checks whether an element equal to the referenced value is in the set, without writing to the list: the deleted nodes it meets are skipped, not unlinked (lock-free, entering the reclamation epoch can retry).
+ * @param list [LinkedListLockFree *] The set.
+ * @param value [const T *] A reference to the value to search for.
+ * @return [bool] Whether the value is in the set.
+ * @throw [assert] If the set is NULL.
+ * @throw [assert] If the value is NULL.
+ */
+bool LinkedList_lockfree_contains(LinkedListLockFree *list, const void *value);
 
 #if LANGUAGE_CPP // C++ support
 }